@@ -3,15 +3,23 @@
  * @brief Implementação de um semáforo com modos normal e noturno usando Raspberry Pi Pico
  *
  * Este programa implementa um semáforo de trânsito com dois modos de operação:
- * - Modo Normal: Ciclo completo verde-amarelo-vermelho
+ * - Modo Normal: Ciclo completo verde-amarelo-vermelho, com verde atuado por detectores
  * - Modo Noturno: Pisca amarelo intermitente
  *
  * O sistema inclui:
  * - Controle de LEDs RGB para indicação visual
- * - Buzzer para indicação sonora sincronizada com as cores
- * - Display OLED para mostrar informações
- * - Botão para alternar entre os modos de operação
- * - FreeRTOS para gerenciamento de tarefas concorrentes
+ * - Buzzer com sinais sonoros acessíveis (tons e amostras via PWM + DMA)
+ * - Display OLED para mostrar informações (e painel de manutenção opcional),
+ *   com o I2C dividido por uma task de barramento (lib/barramento_i2c.h), que
+ *   limita o tempo de cada transferência e destrava o barramento
+ * - Botão para alternar entre os modos de operação (interrupção + debounce por alarme)
+ * - Botoeira de pedestres com espera máxima garantida e aviso "aguarde" imediato
+ * - Console serial com os mesmos comandos das entradas (lib/console.h)
+ * - Preempção para veículos de emergência com latência medida desde a borda
+ * - FreeRTOS para gerenciamento de tarefas concorrentes; os periféricos rodam
+ *   como jobs com prazos em dois executores (lib/executor.h)
+ * - Tickless idle e clock reduzido no modo noturno, com o tempo acordado por
+ *   modo (lib/energia.h)
  */
 
 #include "pico/stdlib.h"
@@ -25,12 +33,31 @@
 #include <stdio.h>
 #include "lib/leds.h"
 #include "lib/matrizRGB.h"
+#include "lib/audio.h"
+#include "lib/entradas.h"
+#include "lib/amostrador_adc.h"
+#include "lib/detectores.h"
+#include "lib/fases.h"
+#include "lib/preempcao.h"
+#include "lib/relogio.h"
+#include "lib/estado_controlador.h"
+#include "lib/comandos.h"
+#include "lib/console.h"
+#include "lib/traco.h"
+#include "lib/perfil_barramento.h"
+#include "lib/executor.h"
+#include "lib/prioridades.h"
+#include "lib/estresse.h"
+#include "lib/energia.h"
+#include "lib/brilho.h"
+#include "lib/compositor.h"
+#include "lib/barramento_i2c.h"
+#include "queue.h"
 #include "pico/bootrom.h"
 #include "hardware/adc.h"
 #include "hardware/pwm.h"
 #include "hardware/clocks.h"
-#include "extras/bitmaps.h"
-#include "extras/Desenho.h"
+#include "assets_gerados.h"
 
 /**
  * Definição de constantes e pinos
@@ -39,42 +66,209 @@
 #define I2C_SDA 14            // Pino de dados SDA
 #define I2C_SCL 15            // Pino de clock SCL
 #define DISPLAY_ADDR 0x3C     // Endereço I2C do display OLED
+#define PAINEL_ADDR 0x3D      // Endereço I2C do OLED do painel de manutenção
 #define BUZZER_PIN 21         // Pino do buzzer
-#define BUZZER_FREQUENCY 100  // Frequência base do buzzer em Hz
 #define BOTAO_MODO 5          // Botão para troca de modo (A)
 #define BOTAO_RESET 6         // Botão para reset (B)3
-#define DEBOUNCE_DELAY_MS 300 // Tempo de debounce para o botão em ms
+#define BOTAO_PEDESTRE 8      // Botoeira de pedestres (externa, ativa em nível baixo)
+#define PREEMPCAO_PINO 9      // Entrada de preempção (receptor de emergência, ativa em nível baixo)
+#define PREEMPCAO_LIBERACAO_MS 3000 // Entrada inativa por este tempo encerra a preempção
+#define PERIODO_CONTROLE_MS 10      // Período de avaliação do motor de fases
+#define ORCAMENTO_TROCA_MS (PERIODO_CONTROLE_MS + 2) // Atraso máximo aceito numa troca de foco (estresse)
+#define DEBOUNCE_DELAY_MS 30  // Janela de debounce do botão em ms
+#define TAMANHO_FILA_ENTRADAS 8 // Eventos de entrada pendentes
 
 /**
- * Enumeração para os modos de operação do semáforo
+ * Detectores de veículos para o controle atuado
+ */
+#define DETECTOR_LACO_CANAL 0     // Canal do ADC do laço analógico (GPIO 26)
+#define DETECTOR_LACO_OCUPADO 3000 // Limiar de ocupação (contagens de 12 bits)
+#define DETECTOR_LACO_LIVRE 2600   // Limiar de liberação (histerese)
+#define DETECTOR_PRESENCA_PINO 22 // Contato de presença (ativo em nível baixo)
+#define TAXA_ADC_HZ 1000          // Amostragem de cada canal do ADC
+
+/**
+ * Tempos de duração para cada estado no modo normal (em ms)
  */
 typedef enum
 {
-    MODO_NORMAL = 0,  // Funcionamento padrão (verde-amarelo-vermelho)
-    MODO_NOTURNO = 1, // Funcionamento noturno (amarelo piscante)
-} ModoOperacao;
+    TEMPO_VERDE = 10000,    // Duração do sinal verde
+    TEMPO_AMARELO = 2000,  // Duração do sinal vermelho
+    TEMPO_VERMELHO = 5000, // Duração do sinal amarelo
+} TempoEstadoNormal;
 
 /**
- * Enumeração para os estados possíveis do semáforo
+ * Limites do verde no controle atuado (em ms)
  */
 typedef enum
 {
-    ESTADO_VERDE = 0,           // Luz verde acesa
-    ESTADO_AMARELO = 1,         // Luz amarela acesa
-    ESTADO_VERMELHO = 2,        // Luz vermelha acesa
-    ESTADO_AMARELO_NOTURNO = 3, // Luz amarela no modo noturno
-    ESTADO_DESLIGADO = 4,       // Todas as luzes desligadas
-} EstadoSemaforo;
+    TEMPO_VERDE_MINIMO = 4000,  // Verde mínimo garantido
+    TEMPO_VERDE_MAXIMO = 20000, // Verde máximo com extensões
+    TEMPO_EXTENSAO = 2500,      // Intervalo sem veículos que encerra o verde
+} TempoVerdeAtuado;
 
 /**
- * Tempos de duração para cada estado no modo normal (em ms)
+ * Planos semafóricos (ver lib/fases.h)
+ *
+ * O plano simples reproduz o semáforo original: a via principal no LED RGB
+ * e uma travessia de pedestres que recebe verde enquanto a via está em
+ * vermelho. O plano de cruzamento controla um cruzamento de quatro braços
+ * mostrado na matriz de LEDs. O grupo 0 de cada plano é o "principal",
+ * cujo estado é exibido no display, na matriz e no buzzer.
  */
-typedef enum
+#define PLANO_CRUZAMENTO_4_BRACOS 0 // 1 = cruzamento de quatro braços na matriz
+#define GRUPO_PRINCIPAL 0
+#define ESPERA_MAX_PEDESTRE 8000 // Espera máxima da botoeira até o verde do pedestre (ms)
+
+enum
 {
-    TEMPO_VERDE = 10000,    // Duração do sinal verde
-    TEMPO_AMARELO = 2000,  // Duração do sinal vermelho
-    TEMPO_VERMELHO = 5000, // Duração do sinal amarelo
-} TempoEstadoNormal;
+    G_PRINCIPAL = 0,
+    G_TRAVESSIA = 1,
+    NUM_GRUPOS_SIMPLES
+};
+
+static const GrupoSinal grupos_simples[NUM_GRUPOS_SIMPLES] = {
+    [G_PRINCIPAL] = {.nome = "via principal", .tipo = GRUPO_VEICULAR, .amarelo_ms = TEMPO_AMARELO,
+                     .detectores = 0x03, .saida = {.tipo = SAIDA_LED_RGB}},
+    [G_TRAVESSIA] = {.nome = "travessia", .tipo = GRUPO_PEDESTRE, .amarelo_ms = 0,
+                     .espera_max_ms = ESPERA_MAX_PEDESTRE, .saida = {.tipo = SAIDA_NENHUMA}},
+};
+
+static const uint32_t conflitos_simples[NUM_GRUPOS_SIMPLES] = {
+    [G_PRINCIPAL] = GRUPO(G_TRAVESSIA),
+    [G_TRAVESSIA] = GRUPO(G_PRINCIPAL),
+};
+
+// entreverdes[i][j]: do fim do verde de i ao início do verde de j (ms)
+static const uint16_t entreverdes_simples[NUM_GRUPOS_SIMPLES * NUM_GRUPOS_SIMPLES] = {
+    0, TEMPO_AMARELO,
+    0, 0};
+
+static const Estagio estagios_simples[] = {
+    {.grupos = GRUPO(G_PRINCIPAL), .controle = CONTROLE_ATUADO, .verde_ms = TEMPO_VERDE,
+     .verde_min_ms = TEMPO_VERDE_MINIMO, .verde_max_ms = TEMPO_VERDE_MAXIMO, .extensao_ms = TEMPO_EXTENSAO},
+    // Vermelho da via principal = verde da travessia (entreverde de volta é zero)
+    {.grupos = GRUPO(G_TRAVESSIA), .controle = CONTROLE_FIXO, .verde_ms = TEMPO_VERMELHO},
+};
+
+// Preempção: verde para a via principal, travessia em vermelho
+static const Estagio preempcao_simples = {.grupos = GRUPO(G_PRINCIPAL), .controle = CONTROLE_FIXO};
+
+static const PlanoSemaforico plano_simples = {
+    .grupos = grupos_simples,
+    .num_grupos = NUM_GRUPOS_SIMPLES,
+    .conflitos = conflitos_simples,
+    .entreverdes = entreverdes_simples,
+    .estagios = estagios_simples,
+    .num_estagios = 2,
+    .preempcao = &preempcao_simples,
+};
+
+/**
+ * Cruzamento de quatro braços: aproximações norte, sul, leste e oeste e
+ * duas travessias (P1 atravessa os braços norte/sul, P2 os braços leste/oeste).
+ * A aproximação norte também é mostrada no LED RGB.
+ */
+#define AMARELO_CRUZAMENTO 3000     // Amarelo / vermelho intermitente (ms)
+#define ENTREVERDE_CRUZAMENTO 4000  // Amarelo + vermelho geral (ms)
+
+enum
+{
+    G_NORTE = 0,
+    G_SUL,
+    G_LESTE,
+    G_OESTE,
+    G_P1,
+    G_P2,
+    NUM_GRUPOS_CRUZAMENTO
+};
+
+static const GrupoSinal grupos_cruzamento[NUM_GRUPOS_CRUZAMENTO] = {
+    [G_NORTE] = {.nome = "norte", .tipo = GRUPO_VEICULAR, .amarelo_ms = AMARELO_CRUZAMENTO, .detectores = 0x01,
+                 .saida = {.tipo = SAIDA_LED_RGB}},
+    [G_SUL] = {.nome = "sul", .tipo = GRUPO_VEICULAR, .amarelo_ms = AMARELO_CRUZAMENTO,
+               .saida = {.tipo = SAIDA_PIXEL_MATRIZ, .x = 2, .y = 4}},
+    [G_LESTE] = {.nome = "leste", .tipo = GRUPO_VEICULAR, .amarelo_ms = AMARELO_CRUZAMENTO, .detectores = 0x02,
+                 .saida = {.tipo = SAIDA_PIXEL_MATRIZ, .x = 4, .y = 2}},
+    [G_OESTE] = {.nome = "oeste", .tipo = GRUPO_VEICULAR, .amarelo_ms = AMARELO_CRUZAMENTO,
+                 .saida = {.tipo = SAIDA_PIXEL_MATRIZ, .x = 0, .y = 2}},
+    [G_P1] = {.nome = "travessia N/S", .tipo = GRUPO_PEDESTRE, .amarelo_ms = AMARELO_CRUZAMENTO,
+              .espera_max_ms = ESPERA_MAX_PEDESTRE,
+              .saida = {.tipo = SAIDA_PIXEL_MATRIZ, .x = 1, .y = 1}},
+    [G_P2] = {.nome = "travessia L/O", .tipo = GRUPO_PEDESTRE, .amarelo_ms = AMARELO_CRUZAMENTO,
+              .espera_max_ms = ESPERA_MAX_PEDESTRE,
+              .saida = {.tipo = SAIDA_PIXEL_MATRIZ, .x = 3, .y = 3}},
+};
+
+static const uint32_t conflitos_cruzamento[NUM_GRUPOS_CRUZAMENTO] = {
+    [G_NORTE] = GRUPO(G_LESTE) | GRUPO(G_OESTE) | GRUPO(G_P1),
+    [G_SUL] = GRUPO(G_LESTE) | GRUPO(G_OESTE) | GRUPO(G_P1),
+    [G_LESTE] = GRUPO(G_NORTE) | GRUPO(G_SUL) | GRUPO(G_P2),
+    [G_OESTE] = GRUPO(G_NORTE) | GRUPO(G_SUL) | GRUPO(G_P2),
+    [G_P1] = GRUPO(G_NORTE) | GRUPO(G_SUL),
+    [G_P2] = GRUPO(G_LESTE) | GRUPO(G_OESTE),
+};
+
+// Todos os pares conflitantes usam o mesmo entreverde; pares compatíveis ficam em zero
+#define EV ENTREVERDE_CRUZAMENTO
+static const uint16_t entreverdes_cruzamento[NUM_GRUPOS_CRUZAMENTO * NUM_GRUPOS_CRUZAMENTO] = {
+    /*          N   S   L   O   P1  P2 */
+    /* N  */ 0, 0, EV, EV, EV, 0,
+    /* S  */ 0, 0, EV, EV, EV, 0,
+    /* L  */ EV, EV, 0, 0, 0, EV,
+    /* O  */ EV, EV, 0, 0, 0, EV,
+    /* P1 */ EV, EV, 0, 0, 0, 0,
+    /* P2 */ 0, 0, EV, EV, 0, 0};
+#undef EV
+
+static const Estagio estagios_cruzamento[] = {
+    {.grupos = GRUPO(G_NORTE) | GRUPO(G_SUL) | GRUPO(G_P2), .controle = CONTROLE_ATUADO, .verde_ms = TEMPO_VERDE,
+     .verde_min_ms = TEMPO_VERDE_MINIMO, .verde_max_ms = TEMPO_VERDE_MAXIMO, .extensao_ms = TEMPO_EXTENSAO},
+    {.grupos = GRUPO(G_LESTE) | GRUPO(G_OESTE) | GRUPO(G_P1), .controle = CONTROLE_ATUADO, .verde_ms = TEMPO_VERDE,
+     .verde_min_ms = TEMPO_VERDE_MINIMO, .verde_max_ms = TEMPO_VERDE_MAXIMO, .extensao_ms = TEMPO_EXTENSAO},
+};
+
+// Preempção: eixo norte/sul em verde, sem travessias
+static const Estagio preempcao_cruzamento = {.grupos = GRUPO(G_NORTE) | GRUPO(G_SUL), .controle = CONTROLE_FIXO};
+
+static const PlanoSemaforico plano_cruzamento = {
+    .grupos = grupos_cruzamento,
+    .num_grupos = NUM_GRUPOS_CRUZAMENTO,
+    .conflitos = conflitos_cruzamento,
+    .entreverdes = entreverdes_cruzamento,
+    .estagios = estagios_cruzamento,
+    .num_estagios = 2,
+    .preempcao = &preempcao_cruzamento,
+};
+
+// Grupo de pedestres atendido pela botoeira
+#if PLANO_CRUZAMENTO_4_BRACOS
+#define PLANO_ATIVO plano_cruzamento
+#define GRUPO_BOTOEIRA G_P1
+#else
+#define PLANO_ATIVO plano_simples
+#define GRUPO_BOTOEIRA G_TRAVESSIA
+#endif
+
+/**
+ * Ampulheta mostrada na matriz enquanto há chamada de pedestre pendente
+ */
+static const uint8_t ampulheta[NP_MATRIX_HEIGHT][NP_MATRIX_WIDTH] = {
+    {1, 1, 1, 1, 1},
+    {0, 1, 1, 1, 0},
+    {0, 0, 1, 0, 0},
+    {0, 1, 0, 1, 0},
+    {1, 1, 1, 1, 1},
+};
+#define INTENSIDADE_AMPULHETA 0.05f
+#define QUADRO_MATRIZ_MS 38      // Intervalo entre quadros da animação da matriz
+#define INTERVALO_DISPLAY_MS 200 // Intervalo entre quadros da animação do display no verde
+#define INTERVALO_PAINEL_MS 1000 // Intervalo entre atualizações do painel de manutenção
+
+// Segundo OLED no mesmo I2C, com contadores para a manutenção: cmake -DSEMAFORO_PAINEL_MANUTENCAO=ON
+#ifndef PAINEL_MANUTENCAO_HABILITADO
+#define PAINEL_MANUTENCAO_HABILITADO 0
+#endif
 
 /**
  * Tempos de ativação do buzzer para cada estado (em ms)
@@ -102,52 +296,297 @@ typedef enum
 } IntervaloBuzzer;
 
 /**
- * Variáveis globais compartilhadas entre tasks
+ * Estado compartilhado entre tasks
+ *
+ * Modo, estado e tempos do controlador só são escritos pela task do
+ * controlador e publicados em lib/estado_controlador.h; os jobs de
+ * periféricos leem o instantâneo a cada execução. Entradas externas chegam
+ * ao controlador como comandos (lib/comandos.h).
  */
-// Variáveis de controle do estado atual
-volatile ModoOperacao modo_atual = MODO_NORMAL;
-volatile EstadoSemaforo estado_atual = ESTADO_VERDE;
-volatile uint8_t contador_ciclo = 1; // Contador para reiniciar o ciclo
-volatile uint8_t contador_ciclo_bitmaps = 1;
-volatile uint8_t contador_ciclo_imagens_verde = 0;
-volatile uint8_t contador_ciclo_imagens_vermelho = 10;
-volatile uint8_t contador_ciclo_imagens = 0;
-volatile bool amarelo_noturno_matriz = false;
 
-// Variáveis de temporização
-volatile uint32_t tempo_global = 0;         // Contador de tempo global
-volatile uint32_t tempo_ultima_mudanca = 0; // Momento da última mudança de estado
-volatile uint32_t tempo_ultimo_botao = 0;   // Momento do último pressionamento do botão
-volatile uint32_t tempo_ultimo_beep = 0;    // Momento do último beep do buzzer
-volatile uint32_t tempo_ultimo_bitmap = 0;  // Momento do último bitmap desenhado
-volatile uint32_t tempo_ultima_imagem = 0;  // Momento da última imagem desenhada
+// Entradas digitais (ver lib/entradas.c)
+QueueHandle_t fila_entradas;  // Eventos de entrada já estabilizados
+static int entrada_modo = -1; // Identificador do botão de modo
+static int entrada_pedestre = -1; // Identificador da botoeira de pedestres
 
-volatile bool buzzer_ativo = false; // Estado atual do buzzer
+/**
+ * Periféricos como jobs de executores (ver lib/executor.h)
+ *
+ * Um executor por nível de lib/prioridades.h: entradas e console acima do
+ * controlador, buzzer e matriz logo abaixo (o buzzer na frente dentro do
+ * executor) e os displays por último. Os displays não esperam o I2C: as
+ * escritas vão para a fila de cada um na task do barramento
+ * (lib/barramento_i2c.h), e a fila vazia acorda o job de novo se ele foi
+ * chamado no meio. O controlador acorda os jobs de saída quando o estado muda.
+ */
+typedef struct
+{
+    bool iniciado;
+    bool ativo;         // Beep tocando
+    uint32_t ultimo_ms; // Início do último beep
+} BeepBuzzer;
+
+typedef struct
+{
+    ssd1306_t oled;
+    Compositor compositor;
+    int camada_modo;           // Nome do modo, no alto à esquerda
+    int camada_barra;          // Verde restante, no alto
+    int camada_contagem;       // Segundos de verde, no alto à direita
+    int camada_aguarde;        // Aviso da botoeira
+    uint32_t ultimo_quadro_ms; // Momento do último quadro da animação
+    uint8_t quadro;            // Quadro exibido da animação do verde
+    uint32_t inicio_verde_ms;  // inicio_fase_ms do verde em curso
+    uint32_t verde_total_ms;   // Escala da barra: restante no início do verde
+    bool aguardando_exibido;   // Aviso da botoeira na tela (a chegada sacode a tela)
+    bool dormindo;     // OLED desligado (modo noturno)
+    uint8_t contraste; // Último contraste enviado ao SSD1306
+    int dispositivo;   // No barramento I2C
+    uint32_t falhas_vistas;   // Falhas do dispositivo já seguidas de reconfiguração
+    volatile bool reexecutar; // O job foi chamado com escritas na fila
+} TelaDisplay;
+
+#define PAINEL_LINHAS 6
+
+typedef struct
+{
+    ssd1306_t oled;
+    Compositor compositor;
+    int linhas[PAINEL_LINHAS]; // Camadas de texto, uma por linha
+    int dispositivo;           // No barramento I2C
+    uint32_t falhas_vistas;
+    volatile bool reexecutar;
+} PainelManutencao;
+
+typedef struct
+{
+    uint8_t cena; // Última cena limpa (0 verde, 1 amarelo, 2 vermelho, 3 noturno, 4 ampulheta)
+    uint8_t quadro_verde;
+    uint8_t quadro_vermelho;
+    CursorMatriz cursor; // Último quadro decodificado (assets delta só aplicam as mudanças)
+} AnimacaoMatriz;
+
+static Executor executor_entradas;
+static Executor executor_saidas;
+static Executor executor_display;
+static Executor executor_telemetria;
+static int job_buzzer = -1;
+static int job_matriz = -1;
+static int job_entradas = -1;
+static int job_display = -1;
+static int job_painel = -1;
+static int job_energia = -1;
+static int job_brilho = -1;
+static int job_status = -1;
+
+static BeepBuzzer beep;
+static TelaDisplay tela = {.quadro = 1, .contraste = 0xFF};
+static PainelManutencao painel;
+
+// O SSD1306 enfileira no gerenciador do barramento
+static const ssd1306_bus_t barramento_oled = {
+    .write = barramento_i2c_escrever,
+    .write_chunks = barramento_i2c_escrever_pedacos,
+    .write_words = barramento_i2c_palavras,
+    .busy = barramento_i2c_ocupado,
+};
+static AnimacaoMatriz animacao;
+
+// Estado do controlador (só a task do controlador lê e escreve)
+static TaskHandle_t tarefa_controlador = NULL;
+static ModoOperacao modo_atual = MODO_NORMAL;
+static EstadoSemaforo estado_atual = ESTADO_VERDE;
+static uint32_t tempo_ultima_mudanca = 0; // Momento da última mudança de estado
+
+// Preempção em andamento (ver lib/preempcao.c)
+static bool preemptando = false;
+static bool resposta_preempcao_registrada = false;
+static bool verde_preempcao_registrado = false;
+static uint64_t borda_preempcao_us = 0;
+static uint32_t entrada_preempcao_ativa_em = 0;
 
 // Protótipos de funções
 void inicializar_buzzer(uint pino);
-void ativar_buzzer(uint pino);
-void desativar_buzzer(uint pino);
+void ativar_buzzer(EstadoSemaforo estado);
+void desativar_buzzer(void);
 
 /**
- * @brief Task para manter o contador de tempo global
+ * @brief Estado exibido (display, matriz e buzzer) a partir do grupo principal
+ */
+static EstadoSemaforo estado_do_grupo_principal(void)
+{
+    switch (fases_cor_grupo(GRUPO_PRINCIPAL))
+    {
+    case SINAL_VERDE:
+        return ESTADO_VERDE;
+    case SINAL_AMARELO:
+        return ESTADO_AMARELO;
+    default:
+        return ESTADO_VERMELHO;
+    }
+}
+
+/**
+ * @brief Entra no modo normal: (re)carrega o plano a partir do vermelho geral
+ */
+static void entrar_modo_normal(uint32_t agora)
+{
+    if (!fases_carregar_plano(&PLANO_ATIVO, agora))
+        panic("plano semaforico invalido");
+    modo_atual = MODO_NORMAL;
+    estado_atual = estado_do_grupo_principal();
+    tempo_ultima_mudanca = agora;
+}
+
+/**
+ * @brief Entra no modo noturno: amarelo intermitente, começando aceso
+ */
+static void entrar_modo_noturno(uint32_t agora)
+{
+    fases_intermitente(true);
+    modo_atual = MODO_NOTURNO;
+    estado_atual = ESTADO_AMARELO_NOTURNO;
+    preemptando = false;
+    tempo_ultima_mudanca = agora;
+}
+
+/**
+ * @brief Inicia a preempção pedida por um comando (só no modo normal)
  *
- * Esta tarefa mantém um contador de tempo global que é usado por outras tarefas
- * para coordenar mudanças de estado e ações sincronizadas.
+ * A troca passa pelo motor de fases, que aplica amarelos, entreverdes e a
+ * conferência de conflitos.
  */
-void vTarefaContadorTempo()
+static void iniciar_preempcao(uint64_t borda_us, uint32_t agora)
 {
-    while (true)
+    if (modo_atual != MODO_NORMAL || preemptando || !fases_preemptar(agora))
+        return;
+
+    preemptando = true;
+    resposta_preempcao_registrada = false;
+    verde_preempcao_registrado = false;
+    borda_preempcao_us = borda_us;
+    entrada_preempcao_ativa_em = agora;
+}
+
+/**
+ * @brief Acompanha a preempção em andamento
+ *
+ * Registra a resposta e o verde da preempção nos instantes em que o motor
+ * de fases trocou as saídas, e a encerra quando a entrada fica inativa por
+ * PREEMPCAO_LIBERACAO_MS depois do verde. As latências contam da borda da
+ * entrada, então incluem a espera do comando na fila até o controlador.
+ *
+ * @return true se a preempção foi encerrada (os focos começam a voltar)
+ */
+static bool acompanhar_preempcao(uint32_t agora)
+{
+    if (!preemptando)
+        return false;
+
+    uint64_t resposta_us = 0;
+    uint64_t verde_us = 0;
+    fases_instantes_preempcao(&resposta_us, &verde_us);
+    if (!resposta_preempcao_registrada && resposta_us != 0)
+    {
+        preempcao_registrar_resposta(borda_preempcao_us, resposta_us);
+        resposta_preempcao_registrada = true;
+    }
+    if (!verde_preempcao_registrado && verde_us != 0)
     {
-        tempo_global = to_ms_since_boot(get_absolute_time());
+        // O limite cobre a fila de comandos: a borda acorda o controlador na
+        // hora, mas o comando pode esperar o fim de uma volta dele (um período)
+        uint32_t limite_ms = fases_limite_preempcao_ms() + PERIODO_CONTROLE_MS;
+        preempcao_registrar_verde(borda_preempcao_us, verde_us, limite_ms * 1000);
+        verde_preempcao_registrado = true;
     }
+
+    // Mantém a preempção enquanto a entrada estiver ativa
+    if (preempcao_entrada_ativa())
+        entrada_preempcao_ativa_em = agora;
+    else if (verde_preempcao_registrado && agora - entrada_preempcao_ativa_em >= PREEMPCAO_LIBERACAO_MS)
+    {
+        fases_encerrar_preempcao(agora);
+        preemptando = false;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Acorda os jobs que seguem o estado (energia, buzzer, display e matriz)
+ */
+static void acordar_saidas(void)
+{
+    executor_acordar(&executor_saidas, job_energia);
+    executor_acordar(&executor_saidas, job_buzzer);
+    executor_acordar(&executor_saidas, job_matriz);
+    executor_acordar(&executor_display, job_display);
+}
+
+/**
+ * @brief Executa um comando no ponto seguro do laço do controlador
+ */
+static void executar_comando(const Comando *comando, uint32_t agora)
+{
+    switch (comando->tipo)
+    {
+    case COMANDO_ALTERNAR_MODO:
+        if (modo_atual == MODO_NORMAL)
+            entrar_modo_noturno(agora);
+        else
+            entrar_modo_normal(agora);
+        break;
+
+    case COMANDO_DEFINIR_MODO:
+        if (comando->argumento == MODO_NOTURNO && modo_atual != MODO_NOTURNO)
+            entrar_modo_noturno(agora);
+        else if (comando->argumento == MODO_NORMAL && modo_atual != MODO_NORMAL)
+            entrar_modo_normal(agora);
+        break;
+
+    case COMANDO_CHAMADA_PEDESTRE:
+        // Registra a chamada no instante da borda; os avisos são acordados depois do comando
+        if (modo_atual == MODO_NORMAL)
+            fases_chamada_pedestre(comando->argumento, (uint32_t)(comando->instante_us / 1000));
+        break;
+
+    case COMANDO_PREEMPCAO:
+        iniciar_preempcao(comando->instante_us, agora);
+        if (comando->origem == ORIGEM_PREEMPCAO)
+            preempcao_rearmar();
+        break;
+
+    case COMANDO_STATUS:
+        // O relatório é longo: sai na task de telemetria, não no controlador
+        executor_acordar(&executor_telemetria, job_status);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Tempo até a próxima borda do pisca noturno
+ *
+ * No modo noturno nada muda entre duas bordas (comandos acordam o
+ * controlador na hora), então ele dorme até a próxima em vez de acordar a
+ * cada PERIODO_CONTROLE_MS e o núcleo fica em WFI no intervalo.
+ */
+static uint32_t ate_borda_noturna(uint32_t agora)
+{
+    uint32_t duracao = (estado_atual == ESTADO_AMARELO_NOTURNO) ? DURACAO_BUZZER_NOTURNO : 500;
+    uint32_t decorrido = agora - tempo_ultima_mudanca;
+    return (decorrido < duracao) ? duracao - decorrido : 0;
 }
 
 /**
  * @brief Task para controle da lógica do semáforo e LEDs
  *
  * Esta tarefa gerencia os estados do semáforo e as transições entre eles,
- * com base no modo atual (normal ou noturno).
+ * com base no modo atual (normal ou noturno). Roda na maior prioridade e
+ * bloqueia entre avaliações; cada comando postado a acorda na hora. Depois
+ * de publicar uma mudança, acorda os jobs dos periféricos.
  */
 void vTarefaControleSemaforo()
 {
@@ -161,404 +600,630 @@ void vTarefaControleSemaforo()
     eu acendo os leds correspondentes!. O que na verdade me limitou com o quesito da matriz, já que eu poderia fazer a animação aqui
     e ficaria tudo sincronizado...
     */
+    entrar_modo_normal(relogio_ms());
+
     while (true)
     {
-        if (modo_atual == MODO_NORMAL)
+        uint32_t agora = relogio_ms();
+        ModoOperacao modo_anterior = modo_atual;
+        EstadoSemaforo estado_anterior = estado_atual;
+        bool mudou = false;
+
+        // Comandos: entre duas atualizações do motor de fases, nunca no meio de uma transição
+        Comando comando;
+        while (comandos_receber(&comando))
         {
-            // Inicialização do ciclo
-            if (contador_ciclo == 1)
-            {
-                acender_led_rgb_cor(COLOR_GREEN);
-                estado_atual = ESTADO_VERDE;
-                contador_ciclo = 2;
-                tempo_ultima_mudanca = tempo_global;
-            }
-
-            // Transição verde -> amarelo
-            if ((tempo_global - tempo_ultima_mudanca >= TEMPO_VERDE) && (estado_atual == ESTADO_VERDE))
-            {
-                acender_led_rgb_cor(COLOR_YELLOW);
-                estado_atual = ESTADO_AMARELO;
-                tempo_ultima_mudanca = tempo_global;
-            }
+            executar_comando(&comando, agora);
+            comandos_concluir(&comando, relogio_us());
+            mudou = true;
+        }
 
-            // Transição amarelo -> vermelho
-            if ((tempo_global - tempo_ultima_mudanca >= TEMPO_AMARELO) && (estado_atual == ESTADO_AMARELO))
-            {
-                acender_led_rgb_cor(COLOR_RED);
-                estado_atual = ESTADO_VERMELHO;
-                tempo_ultima_mudanca = tempo_global;
-            }
+        if (modo_atual == MODO_NORMAL)
+        {
+            // Transições decididas pelo motor de fases (estágios, entreverdes e conflitos)
+            // A preempção também troca os focos, então o estado é sempre conferido
+            mudou |= fases_atualizar(agora);
+            mudou |= acompanhar_preempcao(agora);
 
-            // Transição vermelho -> verde (completa o ciclo)
-            if ((tempo_global - tempo_ultima_mudanca >= TEMPO_VERMELHO) && (estado_atual == ESTADO_VERMELHO))
+            EstadoSemaforo novo = estado_do_grupo_principal();
+            if (novo != estado_atual)
             {
-                acender_led_rgb_cor(COLOR_GREEN);
-                estado_atual = ESTADO_VERDE;
-                tempo_ultima_mudanca = tempo_global;
+                estado_atual = novo;
+                tempo_ultima_mudanca = agora;
             }
         }
 
         else if (modo_atual == MODO_NOTURNO)
         {
-            // Inicialização do modo noturno
-            if (contador_ciclo == 2)
-            {
-                acender_led_rgb_cor(COLOR_YELLOW);
-                estado_atual = ESTADO_AMARELO_NOTURNO;
-                contador_ciclo = 1;
-                tempo_ultima_mudanca = tempo_global;
-            }
-
             // Transição amarelo noturno -> desligado
-            if ((tempo_global - tempo_ultima_mudanca >= DURACAO_BUZZER_NOTURNO) && (estado_atual == ESTADO_AMARELO_NOTURNO))
+            if ((agora - tempo_ultima_mudanca >= DURACAO_BUZZER_NOTURNO) && (estado_atual == ESTADO_AMARELO_NOTURNO))
             {
-                acender_led_rgb_cor(COLOR_BLACK);
+                fases_intermitente(false);
                 estado_atual = ESTADO_DESLIGADO;
-                tempo_ultima_mudanca = tempo_global;
+                tempo_ultima_mudanca = agora;
             }
 
             // Transição desligado -> amarelo noturno
-            if ((tempo_global - tempo_ultima_mudanca >= 500) && (estado_atual == ESTADO_DESLIGADO))
+            if ((agora - tempo_ultima_mudanca >= 500) && (estado_atual == ESTADO_DESLIGADO))
             {
-                acender_led_rgb_cor(COLOR_YELLOW);
+                fases_intermitente(true);
                 estado_atual = ESTADO_AMARELO_NOTURNO;
-                tempo_ultima_mudanca = tempo_global;
+                tempo_ultima_mudanca = agora;
             }
         }
 
-        // Pequeno delay para não sobrecarregar o processador
-        vTaskDelay(pdMS_TO_TICKS(10));
+        EstadoControlador publicado = {
+            .modo = modo_atual,
+            .estado = estado_atual,
+            .inicio_fase_ms = tempo_ultima_mudanca,
+            .restante_ms = fases_verde_restante_ms(agora),
+            .preempcao = preemptando,
+            .ciclos = fases_ciclo(),
+        };
+        estado_controlador_publicar(&publicado);
+
+        // O LED RGB é desta task: o brilho ambiente é aplicado aqui
+        led_definir_brilho(brilho_atual());
+
+        // Os periféricos só rodam fora dos seus prazos quando algo mudou
+        if (mudou || modo_atual != modo_anterior || estado_atual != estado_anterior)
+            acordar_saidas();
+
+        // Aguarda o próximo período (no modo noturno, a próxima borda) ou o próximo comando
+        uint32_t espera = (modo_atual == MODO_NOTURNO) ? ate_borda_noturna(relogio_ms()) : PERIODO_CONTROLE_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(espera));
     }
 }
 
 /**
- * @brief Task para controle do buzzer
+ * @brief Tempos do beep de um estado do modo normal
  *
- * Esta tarefa gerencia os sinais sonoros do buzzer, sincronizados
- * com os estados do semáforo, usando o sistema de temporização
- * baseado no tempo global.
+ * @return false se o estado não tem beep periódico
  */
-void vTarefaControleBuzzer()
+static bool tempos_buzzer(EstadoSemaforo estado, uint32_t *duracao, uint32_t *intervalo)
 {
-    inicializar_buzzer(BUZZER_PIN); // Inicializa o buzzer no pino especificado
-    // Inicializa variáveis de controle
-    tempo_ultimo_beep = tempo_global;
-    int contador = 1;
+    switch (estado)
+    {
+    case ESTADO_VERDE:
+        *duracao = DURACAO_BUZZER_VERDE;
+        *intervalo = INTERVALO_BUZZER_VERDE;
+        return true;
+    case ESTADO_AMARELO:
+        *duracao = DURACAO_BUZZER_AMARELO;
+        *intervalo = INTERVALO_BUZZER_AMARELO;
+        return true;
+    case ESTADO_VERMELHO:
+        *duracao = DURACAO_BUZZER_VERMELHO;
+        *intervalo = INTERVALO_BUZZER_VERMELHO;
+        return true;
+    default:
+        return false;
+    }
+}
 
-    // Ativa o buzzer inicialmente
-    ativar_buzzer(BUZZER_PIN);
-    buzzer_ativo = true;
+/**
+ * @brief Job do buzzer
+ *
+ * Gerencia os sinais sonoros do buzzer, sincronizados com os estados do
+ * semáforo. Em vez de conferir o tempo a cada 10 ms, calcula quando é a
+ * próxima borda do beep (início ou fim) e só roda de novo nela, ou quando
+ * o controlador troca o estado.
+ */
+static uint32_t rodar_buzzer(uint32_t agora, void *contexto)
+{
+    BeepBuzzer *beep = contexto;
+    EstadoControlador controlador;
+    estado_controlador_ler(&controlador);
 
-    while (true)
+    // Primeira execução: o buzzer começa tocando
+    if (!beep->iniciado)
     {
+        ativar_buzzer(controlador.estado);
+        beep->ultimo_ms = agora;
+        beep->ativo = true;
+        beep->iniciado = true;
+    }
 
-        if (modo_atual == MODO_NORMAL)
+    uint32_t duracao, intervalo;
+    if (controlador.modo == MODO_NORMAL && tempos_buzzer(controlador.estado, &duracao, &intervalo))
+    {
+        uint32_t decorrido = agora - beep->ultimo_ms;
+        if (!beep->ativo && decorrido >= intervalo)
         {
-            switch (estado_atual)
-            {
-            case ESTADO_VERDE:
-                // Controle do beep no estado verde
-                if (!buzzer_ativo && (tempo_global - tempo_ultimo_beep >= INTERVALO_BUZZER_VERDE))
-                {
-                    // Inicia o beep
-                    ativar_buzzer(BUZZER_PIN);
-                    tempo_ultimo_beep = tempo_global;
-                    buzzer_ativo = true;
-                }
-                else if (buzzer_ativo && (tempo_global - tempo_ultimo_beep >= DURACAO_BUZZER_VERDE))
-                {
-                    // Finaliza o beep
-                    desativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = false;
-                }
-                break;
-
-            case ESTADO_AMARELO:
-                // Controle do beep no estado amarelo
-                if (!buzzer_ativo && (tempo_global - tempo_ultimo_beep >= INTERVALO_BUZZER_AMARELO))
-                {
-                    // Inicia o beep
-                    ativar_buzzer(BUZZER_PIN);
-                    tempo_ultimo_beep = tempo_global;
-                    buzzer_ativo = true;
-                }
-                else if (buzzer_ativo && (tempo_global - tempo_ultimo_beep >= DURACAO_BUZZER_AMARELO))
-                {
-                    // Finaliza o beep
-                    desativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = false;
-                }
-                break;
-
-            case ESTADO_VERMELHO:
-                // Controle do beep no estado vermelho
-                if (!buzzer_ativo && (tempo_global - tempo_ultimo_beep >= INTERVALO_BUZZER_VERMELHO))
-                {
-                    // Inicia o beep
-                    ativar_buzzer(BUZZER_PIN);
-                    tempo_ultimo_beep = tempo_global;
-                    buzzer_ativo = true;
-                }
-                else if (buzzer_ativo && (tempo_global - tempo_ultimo_beep >= DURACAO_BUZZER_VERMELHO))
-                {
-                    // Finaliza o beep
-                    desativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = false;
-                }
-                break;
-
-            default:
-                // Estado desconhecido - desliga o buzzer
-                if (buzzer_ativo)
-                {
-                    desativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = false;
-                }
-                break;
-            }
+            // Inicia o beep
+            ativar_buzzer(controlador.estado);
+            beep->ultimo_ms = agora;
+            beep->ativo = true;
+            decorrido = 0;
         }
-        // Modo noturno
-        else if (modo_atual == MODO_NOTURNO)
+        else if (beep->ativo && decorrido >= duracao)
         {
-            switch (estado_atual)
-            {
-            case ESTADO_AMARELO_NOTURNO:
-                // Buzzer ativo apenas quando o amarelo está aceso
-                if (!buzzer_ativo)
-                {
-                    ativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = true;
-                    tempo_ultimo_beep = tempo_global;
-                }
-                break;
-
-            case ESTADO_DESLIGADO:
-            case ESTADO_VERDE:
-            case ESTADO_AMARELO:
-            case ESTADO_VERMELHO:
-            default:
-                // Desliga o buzzer em qualquer outro estado
-                if (buzzer_ativo)
-                {
-                    desativar_buzzer(BUZZER_PIN);
-                    buzzer_ativo = false;
-                }
-                break;
-            }
+            // Finaliza o beep
+            desativar_buzzer();
+            beep->ativo = false;
         }
 
-        // Pequeno delay para não sobrecarregar o processador
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // Próxima borda: fim do beep ou início do seguinte
+        uint32_t borda = beep->ativo ? duracao : intervalo;
+        return (decorrido < borda) ? borda - decorrido : 0;
+    }
+
+    // Modo noturno: buzzer ativo apenas quando o amarelo está aceso
+    if (controlador.modo == MODO_NOTURNO && controlador.estado == ESTADO_AMARELO_NOTURNO)
+    {
+        if (!beep->ativo)
+        {
+            ativar_buzzer(controlador.estado);
+            beep->ativo = true;
+            beep->ultimo_ms = agora;
+        }
+    }
+    else if (beep->ativo)
+    {
+        // Desliga o buzzer em qualquer outro estado
+        desativar_buzzer();
+        beep->ativo = false;
     }
+    return EXECUTOR_SEM_PRAZO;
 }
 
 /**
- * @brief Task para controle do display OLED
+ * @brief Job da energia
  *
- * Esta tarefa atualiza o display OLED periodicamente com
- * informações sobre o estado atual do semáforo.
+ * Assume o modo de energia do modo de operação. Roda no executor da
+ * matriz, então a troca do clk_sys nunca cai no meio de um npWrite(), e
+ * na frente do buzzer, que já começa o sinal no clock novo. Com sensor de
+ * corrente, também amostra a corrente a cada ENERGIA_AMOSTRA_CORRENTE_MS.
  */
-void vTarefaControleDisplay()
+static uint32_t rodar_energia(uint32_t agora, void *contexto)
 {
-    // Inicialização do I2C
-    i2c_init(I2C_PORT, 400 * 1000); // Configuração para 400kHz
-
-    // Configuração dos pinos I2C
-    gpio_set_function(I2C_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA);
-    gpio_pull_up(I2C_SCL);
-
-    // Inicialização do display OLED
-    ssd1306_t display;
-    ssd1306_init(&display, WIDTH, HEIGHT, false, DISPLAY_ADDR, I2C_PORT);
-    ssd1306_config(&display);
-    ssd1306_send_data(&display);
-
-    // Limpa o display
-    ssd1306_fill(&display, false);
-    ssd1306_send_data(&display);
-
-    char buffer_info[64]; // Buffer para informações do display
+    (void)agora;
+    (void)contexto;
+    EstadoControlador controlador;
+    estado_controlador_ler(&controlador);
+
+    energia_definir_modo((controlador.modo == MODO_NOTURNO) ? ENERGIA_NOTURNO : ENERGIA_NORMAL);
+    if (!ENERGIA_SENSOR_CORRENTE)
+        return EXECUTOR_SEM_PRAZO;
+    energia_amostrar_corrente();
+    return ENERGIA_AMOSTRA_CORRENTE_MS;
+}
 
-    // Inicializa variáveis de controle
-    tempo_ultimo_bitmap = tempo_global;
+/**
+ * @brief Imprime as estatísticas pedidas pelo comando de status
+ *
+ * Roda na prioridade de telemetria, abaixo de tudo o que tem prazo.
+ */
+static uint32_t rodar_status(uint32_t agora, void *contexto)
+{
+    (void)agora;
+    (void)contexto;
+    comandos_imprimir_estatisticas();
+    executor_imprimir_estatisticas(&executor_entradas);
+    executor_imprimir_estatisticas(&executor_saidas);
+    executor_imprimir_estatisticas(&executor_display);
+    executor_imprimir_estatisticas(&executor_telemetria);
+    barramento_i2c_imprimir_estatisticas();
+    energia_imprimir_estatisticas();
+    return EXECUTOR_SEM_PRAZO;
+}
 
-    while (true)
+/**
+ * @brief Job do brilho ambiente
+ *
+ * Filtra o sensor de luz a cada BRILHO_AMOSTRA_MS. Quando o brilho publicado
+ * muda, refaz a tabela da matriz e reenvia o buffer atual; roda no executor
+ * da matriz, então nunca no meio de um npWrite() e sem avançar a animação.
+ * O controlador aplica o brilho ao LED RGB e o display ao contraste, nas
+ * suas próprias execuções, sem quadros extras no I2C.
+ */
+static uint32_t rodar_brilho(uint32_t agora, void *contexto)
+{
+    (void)contexto;
+    if (!BRILHO_SENSOR_LUZ)
+        return EXECUTOR_SEM_PRAZO;
+    if (brilho_atualizar(agora))
     {
+        npSetBrightness(brilho_atual());
+        npWrite();
+    }
+    return BRILHO_AMOSTRA_MS;
+}
 
-        switch (estado_atual)
-        {
-        case ESTADO_VERDE:
-
-            if ((tempo_global - tempo_ultimo_bitmap >= 200))
-            {
-                // Desenha a imagem atual
-                ssd1306_draw_bitmap(&display, 0, 0, semaforo_images[contador_ciclo_bitmaps], 128, 64);
-                ssd1306_send_data(&display);
-
-                // Atualiza o tempo do último bitmap
-                tempo_ultimo_bitmap = tempo_global;
-
-                // Avança para a próxima imagem (com loop circular)
-                contador_ciclo_bitmaps = (contador_ciclo_bitmaps + 1) % 4;
-            }
+/**
+ * @brief Atualiza as camadas sobre a imagem do semáforo e os efeitos do painel
+ *
+ * Modo no alto à esquerda, barra e segundos do verde restante no alto à
+ * direita e o aviso da botoeira embaixo. O compositor só marca o que de
+ * fato mudou. Os efeitos saem do próprio SSD1306, a poucos bytes de
+ * comando cada: a tela pisca na preempção, sacode quando a botoeira é
+ * aceita e, no vermelho, a legenda de baixo corre como letreiro.
+ *
+ * @return ms até o contador de segundos virar, ou EXECUTOR_SEM_PRAZO
+ */
+static uint32_t atualizar_camadas(TelaDisplay *tela, const EstadoControlador *controlador, uint32_t agora)
+{
+    Compositor *compositor = &tela->compositor;
+    bool aguardando = fases_chamada_pendente(GRUPO_BOTOEIRA);
+    compositor_texto(compositor, tela->camada_modo, controlador->preempcao ? "PREEMP" : "NORMAL");
+    compositor_mostrar(compositor, tela->camada_aguarde, aguardando);
+
+    compositor_piscar(compositor, controlador->preempcao, agora);
+    compositor_letreiro(compositor, controlador->estado == ESTADO_VERMELHO, 6, 7);
+    if (aguardando && !tela->aguardando_exibido)
+        compositor_balancar(compositor, agora);
+    tela->aguardando_exibido = aguardando;
+
+    bool contando = controlador->estado == ESTADO_VERDE && controlador->restante_ms > 0;
+    compositor_mostrar(compositor, tela->camada_contagem, contando);
+    compositor_mostrar(compositor, tela->camada_barra, contando);
+    if (!contando)
+        return EXECUTOR_SEM_PRAZO;
+
+    // A barra começa cheia com o restante visto no início de cada verde
+    if (controlador->inicio_fase_ms != tela->inicio_verde_ms || controlador->restante_ms > tela->verde_total_ms)
+    {
+        tela->inicio_verde_ms = controlador->inicio_fase_ms;
+        tela->verde_total_ms = controlador->restante_ms;
+    }
+    char segundos[8];
+    snprintf(segundos, sizeof(segundos), "%3lu", (unsigned long)((controlador->restante_ms + 999) / 1000));
+    compositor_texto(compositor, tela->camada_contagem, segundos);
+    compositor_barra(compositor, tela->camada_barra, controlador->restante_ms, tela->verde_total_ms);
+    return controlador->restante_ms % 1000 + 1;
+}
 
-            break;
-        case ESTADO_AMARELO:
-            ssd1306_draw_bitmap(&display, 0, 0, semaforo_images[4], 128, 64);
-            ssd1306_send_data(&display);
-            break;
-        case ESTADO_VERMELHO:
-            ssd1306_draw_bitmap(&display, 0, 0, semaforo_images[5], 128, 64);
-            ssd1306_send_data(&display);
-            break;
-        case ESTADO_AMARELO_NOTURNO:
-            ssd1306_draw_bitmap(&display, 0, 0, semaforo_images[4], 128, 64);
-            ssd1306_send_data(&display);
-            break;
-        case ESTADO_DESLIGADO:
-            ssd1306_draw_bitmap(&display, 0, 0, semaforo_images[4], 128, 64);
-            ssd1306_send_data(&display);
-            break;
-        default:
-            break;
-        }
+/**
+ * @brief Pausa de um OLED no barramento; passada a de uma falha, reconfigura o display
+ *
+ * A falha descartou a fila do display, que pode ter reiniciado e perdido a
+ * configuração: ela vai de novo, e a tela inteira. Se ele continua sem
+ * responder, a pausa seguinte é o dobro.
+ *
+ * @return ms até o fim da pausa, ou 0 se o display aceita escritas
+ */
+static uint32_t retomar_oled(ssd1306_t *oled, Compositor *compositor, int dispositivo, uint32_t *falhas_vistas)
+{
+    uint32_t pausa = barramento_i2c_pausa_ms(dispositivo);
+    if (pausa > 0)
+        return pausa;
+    EstatisticasI2C i2c;
+    barramento_i2c_estatisticas(dispositivo, &i2c);
+    if (i2c.falhas != *falhas_vistas)
+    {
+        *falhas_vistas = i2c.falhas;
+        ssd1306_config(oled);
+        compositor_reiniciado(compositor);
     }
+    return 0;
 }
 
-void vTarefaControleMatriz()
+/**
+ * @brief Job do display OLED
+ *
+ * No verde troca o quadro da animação a cada INTERVALO_DISPLAY_MS e o
+ * contador a cada segundo; nos demais estados a tela é fixa e só muda
+ * quando o controlador acorda o job (troca de estado, chamada de pedestre).
+ * O compositor envia só as regiões que mudaram. No modo noturno o OLED
+ * dorme e é redesenhado ao acordar.
+ *
+ * Chamado com escritas do display ainda na fila do barramento, o job só
+ * marca que precisa rodar de novo; a fila vazia (display_enviado) o
+ * acorda. O mesmo vale para as regiões que ainda faltam enviar.
+ *
+ * Com o display em pausa no barramento (falhou), o job dorme até o fim
+ * dela; depois reconfigura o display e redesenha a tela.
+ */
+static uint32_t rodar_display(uint32_t agora, void *contexto)
 {
-    // Inicializa a matriz de LEDs RGB no pino 7
-    npInit(7);
+    TelaDisplay *tela = contexto;
+    tela->reexecutar = true;
+    if (ssd1306_busy(&tela->oled))
+        return EXECUTOR_SEM_PRAZO;
+    tela->reexecutar = false;
+
+    uint32_t falhas = tela->falhas_vistas;
+    uint32_t pausa = retomar_oled(&tela->oled, &tela->compositor, tela->dispositivo, &tela->falhas_vistas);
+    if (pausa > 0)
+        return pausa;
+    if (tela->falhas_vistas != falhas)
+    {
+        // ssd1306_config() acendeu o display com o contraste máximo
+        tela->contraste = 0xFF;
+        tela->dormindo = false;
+    }
 
-    // Inicializa contadores para evitar problemas de memória
-    contador_ciclo_imagens = 0;
-    contador_ciclo_imagens_verde = 0;
-    contador_ciclo_imagens_vermelho = 10;
+    EstadoControlador controlador;
+    estado_controlador_ler(&controlador);
+    Compositor *compositor = &tela->compositor;
 
-    while (true)
+    if (controlador.modo == MODO_NOTURNO)
     {
-        switch (estado_atual)
+        if (!tela->dormindo)
         {
-        case ESTADO_VERDE:
-            // Limpa a matriz ao entrar no estado verde pela primeira vez
-            if (contador_ciclo_imagens != 0)
-            {
-                npClear();
-                contador_ciclo_imagens = 0;
-            }
+            ssd1306_power(&tela->oled, false);
+            tela->dormindo = true;
+        }
+        return EXECUTOR_SEM_PRAZO;
+    }
+    if (tela->dormindo)
+    {
+        ssd1306_power(&tela->oled, true);
+        tela->dormindo = false;
+        compositor_invalidar(compositor);
+    }
 
-            // Exibe o frame atual da animação verde
-            npSetMatrixWithIntensity(caixa_de_desenhos[contador_ciclo_imagens_verde], 1);
+    // Contraste pelo brilho ambiente: dois bytes de comando, junto com a execução que já ia acontecer
+    uint8_t contraste = brilho_atual();
+    if (contraste != tela->contraste)
+    {
+        ssd1306_contrast(&tela->oled, contraste);
+        tela->contraste = contraste;
+    }
 
-            // Avança para o próximo frame da animação, ciclo de 0-9
-            contador_ciclo_imagens_verde = (contador_ciclo_imagens_verde + 1) % 10;
+    uint32_t prazo = EXECUTOR_SEM_PRAZO;
+    switch (controlador.estado)
+    {
+    case ESTADO_VERDE:
+    {
+        // Avança a animação (com loop circular); entre dois quadros só a lâmpada muda
+        uint32_t decorrido = agora - tela->ultimo_quadro_ms;
+        if (decorrido >= INTERVALO_DISPLAY_MS)
+        {
+            tela->quadro = (tela->quadro + 1) % asset_oled_verde.quadros;
+            tela->ultimo_quadro_ms = agora;
+            decorrido = 0;
+        }
+        compositor_fundo(compositor, &asset_oled_verde, tela->quadro);
+        prazo = INTERVALO_DISPLAY_MS - decorrido;
+        break;
+    }
+    case ESTADO_VERMELHO:
+        compositor_fundo(compositor, &asset_oled_vermelho, 0);
+        break;
+    case ESTADO_AMARELO:
+    case ESTADO_AMARELO_NOTURNO:
+    case ESTADO_DESLIGADO:
+        compositor_fundo(compositor, &asset_oled_amarelo, 0);
+        break;
+    default:
+        break;
+    }
 
-            // Aguarda antes do próximo frame
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+    uint32_t contagem = atualizar_camadas(tela, &controlador, agora);
+    if (contagem < prazo)
+        prazo = contagem;
+    uint32_t efeitos = compositor_animar(compositor, agora);
+    if (efeitos < prazo)
+        prazo = efeitos;
+
+    estresse_carga(CARGA_DISPLAY);
+    tela->reexecutar = true;
+    if (!compositor_enviar(compositor))
+        tela->reexecutar = false;
+    return prazo;
+}
 
-        case ESTADO_AMARELO:
-            // Limpa a matriz ao entrar no estado amarelo pela primeira vez
-            if (contador_ciclo_imagens != 1)
-            {
-                npClear();
-                contador_ciclo_imagens = 1;
-            }
+/**
+ * @brief Fila do display vazia (task do barramento)
+ *
+ * Só acorda o job se ele foi chamado durante o envio, quando a tela acabada
+ * de enviar já é a atual, ou se a fila esvaziou por uma falha: o job
+ * precisa saber da pausa para voltar depois dela.
+ */
+static void display_enviado(void *contexto, ResultadoI2C resultado)
+{
+    TelaDisplay *tela = contexto;
+    if (!tela->reexecutar && resultado == I2C_OK)
+        return;
+    tela->reexecutar = false;
+    executor_acordar(&executor_display, job_display);
+}
 
-            vTaskDelay(pdMS_TO_TICKS(38));
-            npSetMatrixWithIntensity(caixa_de_desenhos[22], 1);
+/**
+ * @brief Job do painel de manutenção
+ *
+ * Ciclos do plano, tráfego, espera e falhas do display principal no
+ * barramento e tempo ligado, uma vez por segundo. Só as linhas que mudam
+ * vão ao I2C, e o barramento alterna os pedaços delas com os do display
+ * principal.
+ */
+static uint32_t rodar_painel(uint32_t agora, void *contexto)
+{
+    PainelManutencao *painel = contexto;
+    painel->reexecutar = true;
+    if (ssd1306_busy(&painel->oled))
+        return EXECUTOR_SEM_PRAZO;
+    painel->reexecutar = false;
+
+    uint32_t pausa = retomar_oled(&painel->oled, &painel->compositor, painel->dispositivo, &painel->falhas_vistas);
+    if (pausa > 0)
+        return pausa;
+
+    EstadoControlador controlador;
+    estado_controlador_ler(&controlador);
+    EstatisticasI2C i2c;
+    barramento_i2c_estatisticas(tela.dispositivo, &i2c);
+
+    char linha[24]; // O compositor corta no retângulo
+    snprintf(linha, sizeof(linha), "CICLOS %lu", (unsigned long)controlador.ciclos);
+    compositor_texto(&painel->compositor, painel->linhas[1], linha);
+    snprintf(linha, sizeof(linha), "OLED %luk", (unsigned long)(i2c.bytes / 1024));
+    compositor_texto(&painel->compositor, painel->linhas[2], linha);
+    snprintf(linha, sizeof(linha), "ESPERA %lums", (unsigned long)(i2c.espera_max_us / 1000));
+    compositor_texto(&painel->compositor, painel->linhas[3], linha);
+    snprintf(linha, sizeof(linha), "FALHAS %lu", (unsigned long)i2c.falhas);
+    compositor_texto(&painel->compositor, painel->linhas[4], linha);
+    snprintf(linha, sizeof(linha), "LIGADO %lus", (unsigned long)(agora / 1000));
+    compositor_texto(&painel->compositor, painel->linhas[5], linha);
+
+    painel->reexecutar = true;
+    if (!compositor_enviar(&painel->compositor))
+        painel->reexecutar = false;
+    return INTERVALO_PAINEL_MS - agora % INTERVALO_PAINEL_MS;
+}
 
-            // Aguarda antes da próxima atualização
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+/**
+ * @brief Fila do painel vazia (task do barramento)
+ */
+static void painel_enviado(void *contexto, ResultadoI2C resultado)
+{
+    PainelManutencao *painel = contexto;
+    if (!painel->reexecutar && resultado == I2C_OK)
+        return;
+    painel->reexecutar = false;
+    executor_acordar(&executor_display, job_painel);
+}
 
-        case ESTADO_VERMELHO:
-            // Limpa a matriz ao entrar no estado vermelho pela primeira vez
-            if (contador_ciclo_imagens != 2)
-            {
-                npClear();
-                contador_ciclo_imagens = 2;
-            }
+/**
+ * @brief Desenha a ampulheta de "aguarde" da botoeira
+ */
+static void desenhar_ampulheta(void)
+{
+    npClear();
+    for (int y = 0; y < NP_MATRIX_HEIGHT; y++)
+        for (int x = 0; x < NP_MATRIX_WIDTH; x++)
+            if (ampulheta[y][x])
+                npSetLEDIntensity(x, y, COLOR_WHITE, INTENSIDADE_AMPULHETA);
+    npWrite();
+}
 
-            // Exibe o frame atual da animação vermelha
-            npSetMatrixWithIntensity(caixa_de_desenhos[contador_ciclo_imagens_vermelho], 1);
+/**
+ * @brief Job da matriz de LEDs
+ *
+ * Só as animações do verde e do vermelho têm quadros periódicos; as cenas
+ * fixas (amarelo, noturno, ampulheta, painel de focos) são desenhadas uma
+ * vez e refeitas quando o controlador acorda o job.
+ */
+static uint32_t rodar_matriz(uint32_t agora, void *contexto)
+{
+    (void)agora;
+    AnimacaoMatriz *animacao = contexto;
+    EstadoControlador controlador;
+    estado_controlador_ler(&controlador);
+    estresse_carga(CARGA_MATRIZ);
+
+    // Planos com grupos mapeados em pixels usam a matriz como painel de focos
+    if (fases_usa_matriz())
+    {
+        fases_desenhar_matriz();
+        return EXECUTOR_SEM_PRAZO;
+    }
 
-            // Avança para o próximo frame da animação, ciclo de 10-22
-            contador_ciclo_imagens_vermelho++;
-            if (contador_ciclo_imagens_vermelho >= 22)
-                contador_ciclo_imagens_vermelho = 10;
+    // Chamada de pedestre pendente (veículos ainda em verde): ampulheta
+    if (controlador.modo == MODO_NORMAL && controlador.estado == ESTADO_VERDE &&
+        fases_chamada_pendente(GRUPO_BOTOEIRA))
+    {
+        desenhar_ampulheta();
+        animacao->cena = 4;
+        return EXECUTOR_SEM_PRAZO;
+    }
 
-            // Aguarda antes do próximo frame
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+    switch (controlador.estado)
+    {
+    case ESTADO_VERDE:
+        // Limpa a matriz ao entrar no estado verde pela primeira vez
+        if (animacao->cena != 0)
+        {
+            npClear();
+            animacao->cena = 0;
+        }
 
-        case ESTADO_AMARELO_NOTURNO:
-            // Limpa a matriz ao entrar no estado noturno pela primeira vez
-            if (contador_ciclo_imagens != 3)
-            {
-                npClear();
-                contador_ciclo_imagens = 3;
-            }
+        // Exibe o frame atual da animação verde e avança em ciclo
+        asset_matriz_desenhar(&animacao->cursor, &asset_matriz_verde, animacao->quadro_verde);
+        animacao->quadro_verde = (animacao->quadro_verde + 1) % asset_matriz_verde.quadros;
+        return QUADRO_MATRIZ_MS;
 
-            // Sincroniza com o estado do LED amarelo
-            // Em ESTADO_AMARELO_NOTURNO o LED estará aceso
-            npSetMatrixWithIntensity(caixa_de_desenhos[22], 1);
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+    case ESTADO_AMARELO:
+        // Limpa a matriz ao entrar no estado amarelo pela primeira vez
+        if (animacao->cena != 1)
+        {
+            npClear();
+            animacao->cena = 1;
+        }
+        asset_matriz_desenhar(&animacao->cursor, &asset_matriz_amarelo, 0);
+        break;
 
-        case ESTADO_DESLIGADO:
-            // No modo noturno quando o LED está desligado
-            // Garantimos que a matriz também esteja desligada
+    case ESTADO_VERMELHO:
+        // Limpa a matriz ao entrar no estado vermelho pela primeira vez
+        if (animacao->cena != 2)
+        {
             npClear();
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+            animacao->cena = 2;
+        }
+
+        // Exibe o frame atual da animação vermelha e avança em ciclo
+        asset_matriz_desenhar(&animacao->cursor, &asset_matriz_vermelho, animacao->quadro_vermelho);
+        animacao->quadro_vermelho = (animacao->quadro_vermelho + 1) % asset_matriz_vermelho.quadros;
+        return QUADRO_MATRIZ_MS;
 
-        default:
-            // Caso de segurança para estados desconhecidos
+    case ESTADO_AMARELO_NOTURNO:
+        // Limpa a matriz ao entrar no estado noturno pela primeira vez
+        if (animacao->cena != 3)
+        {
             npClear();
-            vTaskDelay(pdMS_TO_TICKS(38));
-            break;
+            animacao->cena = 3;
         }
+
+        // Sincroniza com o estado do LED amarelo (aceso)
+        asset_matriz_desenhar(&animacao->cursor, &asset_matriz_amarelo, 0);
+        break;
+
+    case ESTADO_DESLIGADO:
+    default:
+        // LED apagado no modo noturno (ou estado desconhecido): matriz desligada
+        npClear();
+        break;
     }
+    return EXECUTOR_SEM_PRAZO;
 }
 
 /**
- * @brief Task para monitoramento do botão de troca de modo
+ * @brief Job dos eventos de entrada
  *
- * Esta tarefa verifica o estado do botão e alterna entre os modos
- * normal e noturno quando o botão é pressionado.
+ * Acordado pela interrupção de debounce a cada evento postado na fila (ver
+ * lib/entradas.c). O botão de modo e a botoeira de pedestres viram comandos
+ * para o controlador.
  */
-void vTarefaMonitoramentoBotao()
+static uint32_t rodar_entradas(uint32_t agora, void *contexto)
 {
+    (void)agora;
+    (void)contexto;
+    EventoEntrada evento;
 
-    // Inicialização dos pinos de botões
-    gpio_init(BOTAO_MODO);
-    gpio_init(BOTAO_RESET);
-    gpio_set_dir(BOTAO_MODO, GPIO_IN);
-    gpio_set_dir(BOTAO_RESET, GPIO_IN);
-    gpio_pull_up(BOTAO_MODO);
-    gpio_pull_up(BOTAO_RESET);
-
-    while (true)
+    while (xQueueReceive(fila_entradas, &evento, 0) == pdTRUE)
     {
-        // Verifica se já passou o tempo de debounce desde o último pressionamento
-        if ((tempo_global - tempo_ultimo_botao > DEBOUNCE_DELAY_MS) &&
-            (gpio_get(BOTAO_MODO) == 0))
-        { // Botão pressionado (nível baixo)
+        // Só transições para ativo viram comandos, com o instante da primeira borda
+        if (!evento.ativo)
+            continue;
 
-            // Alterna entre os modos
-            modo_atual = (modo_atual == MODO_NORMAL) ? MODO_NOTURNO : MODO_NORMAL;
-
-            // Atualiza o timestamp do último pressionamento
-            tempo_ultimo_botao = tempo_global;
+        Comando comando = {.instante_us = evento.tempo_us};
+        if (evento.id == entrada_modo)
+        {
+            comando.tipo = COMANDO_ALTERNAR_MODO;
+            comando.origem = ORIGEM_BOTAO;
+        }
+        else if (evento.id == entrada_pedestre)
+        {
+            comando.tipo = COMANDO_CHAMADA_PEDESTRE;
+            comando.origem = ORIGEM_BOTOEIRA;
+            comando.argumento = GRUPO_BOTOEIRA;
         }
+        else
+            continue;
 
-        // Pequeno delay para não sobrecarregar o processador
-        vTaskDelay(pdMS_TO_TICKS(10));
+        if (!comandos_enviar(&comando))
+            printf("entradas: fila de comandos cheia, %s descartado\n", comandos_nome(comando.tipo));
     }
+    return EXECUTOR_SEM_PRAZO;
+}
+
+/**
+ * @brief Aviso da interrupção de debounce: põe o job de entradas para rodar
+ */
+static void avisar_entrada(BaseType_t *acordar)
+{
+    executor_acordar_de_isr(&executor_entradas, job_entradas, acordar);
 }
 
 /**
@@ -574,60 +1239,61 @@ void gpio_irq_handler(uint gpio, uint32_t events)
 }
 
 /**
- * @brief Inicializa o PWM para o buzzer
+ * @brief Inicializa o motor de áudio no pino do buzzer
  *
- * Configura o pino do buzzer como saída de PWM para controle de som.
+ * O buzzer é acionado por PWM alimentado por DMA (ver lib/audio.c), então
+ * as tasks apenas escolhem qual sinal sonoro tocar.
  *
  * @param pino Número do pino GPIO do buzzer
  */
 void inicializar_buzzer(uint pino)
 {
-    // Configura o pino como saída de PWM
-    gpio_set_function(pino, GPIO_FUNC_PWM);
-
-    // Obtém o slice do PWM associado ao pino
-    uint slice_num = pwm_gpio_to_slice_num(pino);
-
-    // Configura o PWM com frequência desejada
-    pwm_config config = pwm_get_default_config();
-    // Cálculo do divisor para obter a frequência desejada
-    pwm_config_set_clkdiv(&config, clock_get_hz(clk_sys) / (BUZZER_FREQUENCY * 4096));
-    pwm_init(slice_num, &config, true);
+    audio_init(pino);
+}
 
-    // Inicializa o PWM no nível baixo (sem som)
-    pwm_set_gpio_level(pino, 0);
+/**
+ * @brief Retorna o sinal sonoro acessível correspondente a um estado
+ *
+ * @param estado Estado atual do semáforo
+ */
+static AudioCueId cue_do_estado(EstadoSemaforo estado)
+{
+    switch (estado)
+    {
+    case ESTADO_VERDE:
+        return AUDIO_CUE_VERDE;
+    case ESTADO_AMARELO:
+        return AUDIO_CUE_AMARELO;
+    case ESTADO_VERMELHO:
+        return AUDIO_CUE_VERMELHO;
+    case ESTADO_AMARELO_NOTURNO:
+        return AUDIO_CUE_NOTURNO;
+    default:
+        return AUDIO_CUE_LOCALIZADOR;
+    }
 }
 
 /**
  * @brief Ativa o buzzer
  *
- * Configura o PWM para ativar o buzzer.
+ * Inicia o sinal sonoro do estado informado. O sinal se repete até
+ * desativar_buzzer() ser chamada.
  *
- * @param pino Número do pino GPIO do buzzer
+ * @param estado Estado do semáforo que define o sinal
  */
-void ativar_buzzer(uint pino)
+void ativar_buzzer(EstadoSemaforo estado)
 {
-    // Obtém o slice do PWM associado ao pino
-    uint slice_num = pwm_gpio_to_slice_num(pino);
-
-    // Configura o duty cycle para 50% (ativo)
-    pwm_set_gpio_level(pino, 2048);
+    audio_tocar_cue(cue_do_estado(estado));
 }
 
 /**
  * @brief Desativa o buzzer
  *
- * Configura o PWM para desativar o buzzer.
- *
- * @param pino Número do pino GPIO do buzzer
+ * Interrompe o DMA de áudio e deixa o PWM em nível baixo.
  */
-void desativar_buzzer(uint pino)
+void desativar_buzzer(void)
 {
-    // Obtém o slice do PWM associado ao pino
-    uint slice_num = pwm_gpio_to_slice_num(pino);
-
-    // Desativa o sinal PWM (duty cycle 0)
-    pwm_set_gpio_level(pino, 0);
+    audio_parar();
 }
 
 /**
@@ -637,30 +1303,144 @@ void desativar_buzzer(uint pino)
  */
 int main()
 {
+    // clk_peri fixo em 48 MHz antes de calcular os baud rates (ver lib/energia.h)
+    energia_iniciar();
+
     // Inicialização do sistema
     stdio_init_all();
 
     // Configura interrupção para o botão de reset
+    gpio_init(BOTAO_RESET);
+    gpio_set_dir(BOTAO_RESET, GPIO_IN);
+    gpio_pull_up(BOTAO_RESET);
     gpio_set_irq_enabled_with_callback(BOTAO_RESET, GPIO_IRQ_EDGE_FALL, true, &gpio_irq_handler);
 
-    // Cria as tarefas do sistema - mantendo a estrutura original do FreeRTOS
-    xTaskCreate(vTarefaContadorTempo, "Contador de Tempo", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
-
-    xTaskCreate(vTarefaControleSemaforo, "Controle do Semaforo", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
-
-    xTaskCreate(vTarefaControleBuzzer, "Controle do Buzzer", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
-
-    xTaskCreate(vTarefaControleDisplay, "Controle do Display", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
+    // Registra as entradas digitais e habilita as interrupções de borda
+    ConfigEntrada botao_modo = {.pino = BOTAO_MODO, .ativo_baixo = true, .debounce_ms = DEBOUNCE_DELAY_MS};
+    entrada_modo = entradas_registrar(&botao_modo);
+    ConfigEntrada contato_presenca = {.pino = DETECTOR_PRESENCA_PINO, .ativo_baixo = true};
+    int entrada_presenca = entradas_registrar(&contato_presenca);
+    ConfigEntrada botoeira = {.pino = BOTAO_PEDESTRE, .ativo_baixo = true, .debounce_ms = DEBOUNCE_DELAY_MS};
+    entrada_pedestre = entradas_registrar(&botoeira);
+    fila_entradas = xQueueCreate(TAMANHO_FILA_ENTRADAS, sizeof(EventoEntrada));
+    entradas_iniciar(fila_entradas);
+
+    // Detectores do controle atuado: laço analógico (ADC + DMA) e contato de presença
+    // Os sensores de corrente e de luz, se houver, usam outros canais do mesmo amostrador
+    uint8_t canais_adc = 1u << DETECTOR_LACO_CANAL;
+#if ENERGIA_SENSOR_CORRENTE
+    canais_adc |= 1u << ENERGIA_CANAL_CORRENTE;
+#endif
+#if BRILHO_SENSOR_LUZ
+    canais_adc |= 1u << BRILHO_CANAL_LUZ;
+#endif
+    amostrador_adc_iniciar(canais_adc, TAXA_ADC_HZ);
+    ConfigDetector laco = {
+        .tipo = DETECTOR_ANALOGICO,
+        .fonte = DETECTOR_LACO_CANAL,
+        .limiar_ocupado = DETECTOR_LACO_OCUPADO,
+        .limiar_liberado = DETECTOR_LACO_LIVRE,
+    };
+    ConfigDetector presenca = {.tipo = DETECTOR_DIGITAL, .fonte = (uint8_t)entrada_presenca};
+    detectores_registrar(&laco);
+    detectores_registrar(&presenca);
+
+    // Traço das saídas para comparação (só com TRACO_HABILITADO, ver lib/traco.h)
+    traco_iniciar();
+
+    // Uso dos barramentos I2C e PIO por task (só com PERFIL_BARRAMENTO_HABILITADO)
+    perfil_barramento_iniciar();
+
+    // Carga artificial na renderização e conferência do atraso das trocas (só com ESTRESSE_HABILITADO)
+    estresse_iniciar(ORCAMENTO_TROCA_MS);
+
+    // Periféricos: inicializados aqui e atualizados pelos jobs dos executores
+    inicializar_buzzer(BUZZER_PIN);
+
+    // I2C a 400kHz; até o escalonador começar os displays escrevem direto
+    // (com prazo), depois só pela task do barramento, que guarda os pinos
+    // para destravar o barramento
+    barramento_i2c_iniciar(I2C_PORT, I2C_SDA, I2C_SCL, 400 * 1000);
+    ssd1306_init(&tela.oled, WIDTH, HEIGHT, false, DISPLAY_ADDR, I2C_PORT);
+    ssd1306_config(&tela.oled);
+    ssd1306_send_data(&tela.oled);
+    ssd1306_fill(&tela.oled, false);
+    ssd1306_send_data(&tela.oled);
+    tela.ultimo_quadro_ms = relogio_ms();
+
+    // Daqui em diante os displays usam a fila do barramento; o painel de
+    // manutenção tem prioridade menor, mas não fica sem vez
+    tela.dispositivo = barramento_i2c_registrar(DISPLAY_ADDR, 1, display_enviado, &tela);
+    ssd1306_attach_bus(&tela.oled, &barramento_oled, tela.dispositivo);
+    if (PAINEL_MANUTENCAO_HABILITADO)
+    {
+        ssd1306_init(&painel.oled, WIDTH, HEIGHT, false, PAINEL_ADDR, I2C_PORT);
+        ssd1306_config(&painel.oled);
+        ssd1306_send_data(&painel.oled);
+        painel.dispositivo = barramento_i2c_registrar(PAINEL_ADDR, 0, painel_enviado, &painel);
+        ssd1306_attach_bus(&painel.oled, &barramento_oled, painel.dispositivo);
+
+        // Fundo apagado e uma camada de texto por linha
+        compositor_init(&painel.compositor, &painel.oled);
+        for (int i = 0; i < PAINEL_LINHAS; i++)
+        {
+            painel.linhas[i] = compositor_adicionar(&painel.compositor, CAMADA_TEXTO, 0, 2 + 10 * i, WIDTH, 8);
+            compositor_mostrar(&painel.compositor, painel.linhas[i], true);
+        }
+        compositor_texto(&painel.compositor, painel.linhas[0], "MANUTENCAO");
+    }
 
-    xTaskCreate(vTarefaControleMatriz, "Controle da Matriz", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
+    // Camadas sobre a imagem do semáforo, na faixa livre do alto e sobre o texto de baixo
+    compositor_init(&tela.compositor, &tela.oled);
+    tela.camada_modo = compositor_adicionar(&tela.compositor, CAMADA_TEXTO, 2, 1, 56, 8);
+    tela.camada_barra = compositor_adicionar(&tela.compositor, CAMADA_BARRA, 60, 2, 40, 6);
+    tela.camada_contagem = compositor_adicionar(&tela.compositor, CAMADA_TEXTO, 102, 1, 24, 8);
+    tela.camada_aguarde = compositor_adicionar(&tela.compositor, CAMADA_TEXTO, 34, 52, 60, 12);
+    compositor_texto(&tela.compositor, tela.camada_aguarde, "AGUARDE");
+    compositor_mostrar(&tela.compositor, tela.camada_modo, true);
+
+    npInit(7); // Matriz de LEDs RGB no pino 7
+
+    // O que depende do clk_sys é reajustado a cada troca de modo de energia
+    energia_avisar_clock(audio_ajustar_clock);
+    energia_avisar_clock(npUpdateClock);
+    energia_avisar_clock(led_ajustar_clock);
+
+    // Todos os jobs rodam uma vez no início; depois, nos prazos que devolvem ou
+    // quando acordados (as entradas, pela interrupção de debounce). Entre jobs
+    // vencidos do mesmo executor, o de maior prioridade passa na frente.
+    job_entradas = executor_adicionar(&executor_entradas, "entradas", rodar_entradas, NULL, 1, 0);
+    job_energia = executor_adicionar(&executor_saidas, "energia", rodar_energia, NULL, 2, 0);
+    job_buzzer = executor_adicionar(&executor_saidas, "buzzer", rodar_buzzer, &beep, 1, 0);
+    job_matriz = executor_adicionar(&executor_saidas, "matriz", rodar_matriz, &animacao, 0, 0);
+    job_brilho = executor_adicionar(&executor_saidas, "brilho", rodar_brilho, NULL, 0, BRILHO_AMOSTRA_MS);
+    job_display = executor_adicionar(&executor_display, "display", rodar_display, &tela, 1, 0);
+    if (PAINEL_MANUTENCAO_HABILITADO)
+        job_painel = executor_adicionar(&executor_display, "painel", rodar_painel, &painel, 0, 0);
+    job_status = executor_adicionar(&executor_telemetria, "status", rodar_status, NULL, 0, EXECUTOR_SEM_PRAZO);
+    entradas_definir_aviso(avisar_entrada);
 
-    xTaskCreate(vTarefaMonitoramentoBotao, "Monitoramento do Botao", configMINIMAL_STACK_SIZE,
-                NULL, tskIDLE_PRIORITY, NULL);
+    // Cria as tarefas do sistema - mantendo a estrutura original do FreeRTOS
+    xTaskCreate(vTarefaControleSemaforo, "Controle do Semaforo", configMINIMAL_STACK_SIZE,
+                NULL, prioridades_de(PAPEL_CONTROLE), &tarefa_controlador);
+    prioridades_registrar(PAPEL_CONTROLE, tarefa_controlador);
+
+    // Entradas externas chegam ao controlador como comandos; a preempção os posta da interrupção
+    comandos_iniciar(tarefa_controlador);
+    preempcao_iniciar(PREEMPCAO_PINO);
+    console_iniciar(&executor_entradas, 0, GRUPO_BOTOEIRA);
+
+    executor_iniciar(&executor_entradas, "Entradas", configMINIMAL_STACK_SIZE, prioridades_de(PAPEL_ENTRADAS));
+    executor_iniciar(&executor_saidas, "Saidas", configMINIMAL_STACK_SIZE, prioridades_de(PAPEL_SAIDAS));
+    executor_iniciar(&executor_display, "Display", configMINIMAL_STACK_SIZE, prioridades_de(PAPEL_DISPLAY));
+    executor_iniciar(&executor_telemetria, "Telemetria", configMINIMAL_STACK_SIZE, prioridades_de(PAPEL_TELEMETRIA));
+    prioridades_registrar(PAPEL_ENTRADAS, executor_entradas.tarefa);
+    prioridades_registrar(PAPEL_SAIDAS, executor_saidas.tarefa);
+    prioridades_registrar(PAPEL_DISPLAY, executor_display.tarefa);
+    prioridades_registrar(PAPEL_TELEMETRIA, executor_telemetria.tarefa);
+
+    // Confere o esquema de prioridades antes de qualquer task rodar
+    prioridades_verificar();
 
     // Inicia o scheduler do FreeRTOS
     vTaskStartScheduler();
@@ -0,0 +1,38 @@
+# Assets gerados na compilação (lib/assets.h)
+#
+#   include(assets/assets.cmake)
+#   semaforo_assets(alvo)
+#
+# Gera assets_gerados.h/.c em ${CMAKE_BINARY_DIR}/assets a partir de
+# assets/oled e assets/matriz e acrescenta ao alvo. A lista de fontes é
+# refeita a cada build (CONFIGURE_DEPENDS): um arquivo novo na pasta já
+# entra no próximo build, sem rodar o cmake de novo.
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(SEMAFORO_ASSETS_FONTES ${CMAKE_CURRENT_LIST_DIR})
+
+function(semaforo_assets alvo)
+    set(saida ${CMAKE_BINARY_DIR}/assets)
+    if(NOT TARGET semaforo_assets_gerados)
+        file(GLOB fontes CONFIGURE_DEPENDS
+            ${SEMAFORO_ASSETS_FONTES}/oled/*.pbm
+            ${SEMAFORO_ASSETS_FONTES}/oled/*.png
+            ${SEMAFORO_ASSETS_FONTES}/matriz/*.png
+            ${SEMAFORO_ASSETS_FONTES}/matriz/*.txt
+        )
+        add_custom_command(
+            OUTPUT ${saida}/assets_gerados.h ${saida}/assets_gerados.c
+            COMMAND ${Python3_EXECUTABLE} ${SEMAFORO_ASSETS_FONTES}/compilar_assets.py
+                --fontes ${SEMAFORO_ASSETS_FONTES} --saida ${saida}
+            DEPENDS ${SEMAFORO_ASSETS_FONTES}/compilar_assets.py ${fontes}
+            COMMENT "Compilando assets do OLED e da matriz"
+            VERBATIM
+        )
+        # Um só dono da regra: os alvos que usam os assets esperam por ele
+        add_custom_target(semaforo_assets_gerados DEPENDS ${saida}/assets_gerados.h ${saida}/assets_gerados.c)
+    endif()
+    target_sources(${alvo} PRIVATE ${saida}/assets_gerados.c)
+    target_include_directories(${alvo} PRIVATE ${saida})
+    add_dependencies(${alvo} semaforo_assets_gerados)
+endfunction()
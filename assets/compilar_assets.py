@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+"""
+Compilador de assets: imagens de assets/ -> tabelas const em C (lib/assets.h)
+
+    compilar_assets.py --fontes assets --saida build/assets
+
+Lê assets/oled/*.{pbm,png} e assets/matriz/*.{png,txt} e escreve
+assets_gerados.h e assets_gerados.c em --saida. Só usa a biblioteca padrão
+(o PNG é descomprimido com zlib), então roda onde o SDK do Pico já roda.
+
+Cada arquivo é uma animação; "nome_N.ext" é o quadro N da animação "nome".
+Um .txt da matriz pode ter vários quadros: 25 valores 0xAARRGGBB cada, na
+ordem das linhas; o resto do texto (chaves, vírgulas, comentários) é
+ignorado, então os literais do antigo ConversorHEXADECIMAL_RGB.C servem.
+
+Na imagem do OLED, pixel claro = pixel aceso (no PBM, 0 = aceso: o branco
+do arquivo é o que acende na tela). Na matriz, a cor é multiplicada pelo
+alfa.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+MATRIZ_LADO = 5
+MATRIZ_PIXELS = MATRIZ_LADO * MATRIZ_LADO
+OLED_LARGURA_MAX = 128
+OLED_ALTURA_MAX = 64
+IC_DATA_CMD_STOP = 0x200
+
+
+class ErroAsset(Exception):
+    pass
+
+
+# Leitura das imagens: (largura, altura, [(r, g, b, a)] linha a linha)
+
+def ler_pbm(caminho):
+    with open(caminho, 'rb') as f:
+        conteudo = f.read()
+    # Cabeçalho: número mágico, largura e altura, com comentários '#'
+    campos = []
+    pos = 0
+    while len(campos) < 3:
+        m = re.compile(rb'\s*(#[^\n]*\n\s*)*(\S+)').match(conteudo, pos)
+        if not m:
+            raise ErroAsset('cabeçalho PBM incompleto')
+        campos.append(m.group(2))
+        pos = m.end()
+    magico, largura, altura = campos[0], int(campos[1]), int(campos[2])
+    if magico == b'P1':
+        bits = [int(c) for c in re.sub(rb'#[^\n]*', b'', conteudo[pos:]).decode('ascii') if c in '01']
+    elif magico == b'P4':
+        pos += 1  # Um espaço separa o cabeçalho dos dados
+        por_linha = (largura + 7) // 8
+        bits = []
+        for y in range(altura):
+            linha = conteudo[pos + y * por_linha:pos + (y + 1) * por_linha]
+            bits += [(linha[x // 8] >> (7 - x % 8)) & 1 for x in range(largura)]
+    else:
+        raise ErroAsset('PBM %s não suportado (só P1 e P4)' % magico.decode('ascii', 'replace'))
+    if len(bits) < largura * altura:
+        raise ErroAsset('PBM com %d de %d pixels' % (len(bits), largura * altura))
+    # 1 no PBM é preto
+    return largura, altura, [(0, 0, 0, 255) if b else (255, 255, 255, 255) for b in bits[:largura * altura]]
+
+
+def ler_png(caminho):
+    with open(caminho, 'rb') as f:
+        conteudo = f.read()
+    if conteudo[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ErroAsset('não é PNG')
+    pos = 8
+    idat = b''
+    paleta = []
+    transparencia = b''
+    while pos < len(conteudo):
+        tamanho, tipo = struct.unpack('>I4s', conteudo[pos:pos + 8])
+        dados = conteudo[pos + 8:pos + 8 + tamanho]
+        pos += 12 + tamanho
+        if tipo == b'IHDR':
+            largura, altura, profundidade, cor, _, _, entrelacado = struct.unpack('>IIBBBBB', dados)
+        elif tipo == b'PLTE':
+            paleta = [tuple(dados[i:i + 3]) for i in range(0, len(dados), 3)]
+        elif tipo == b'tRNS':
+            transparencia = dados
+        elif tipo == b'IDAT':
+            idat += dados
+        elif tipo == b'IEND':
+            break
+    if entrelacado:
+        raise ErroAsset('PNG entrelaçado não suportado')
+    canais = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[cor]
+    bits_pixel = canais * profundidade
+    por_linha = (largura * bits_pixel + 7) // 8
+    passo = max(1, bits_pixel // 8)  # Bytes do pixel anterior nos filtros
+    bruto = zlib.decompress(idat)
+
+    linhas = []
+    anterior = bytearray(por_linha)
+    for y in range(altura):
+        inicio = y * (por_linha + 1)
+        filtro = bruto[inicio]
+        linha = bytearray(bruto[inicio + 1:inicio + 1 + por_linha])
+        for i in range(por_linha):
+            a = linha[i - passo] if i >= passo else 0
+            b = anterior[i]
+            c = anterior[i - passo] if i >= passo else 0
+            if filtro == 1:
+                linha[i] = (linha[i] + a) & 0xff
+            elif filtro == 2:
+                linha[i] = (linha[i] + b) & 0xff
+            elif filtro == 3:
+                linha[i] = (linha[i] + (a + b) // 2) & 0xff
+            elif filtro == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                linha[i] = (linha[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        linhas.append(linha)
+        anterior = linha
+
+    def amostras(linha):
+        if profundidade == 8:
+            return list(linha)
+        if profundidade == 16:
+            return list(linha[0::2])  # Byte alto
+        mascara = (1 << profundidade) - 1
+        return [(byte >> (8 - profundidade - k)) & mascara for byte in linha for k in range(0, 8, profundidade)]
+
+    escala = 255 // ((1 << min(profundidade, 8)) - 1)
+    pixels = []
+    for linha in linhas:
+        valores = amostras(linha)
+        for x in range(largura):
+            v = valores[x * canais:(x + 1) * canais]
+            if cor == 3:
+                r, g, b = paleta[v[0]]
+                a = transparencia[v[0]] if v[0] < len(transparencia) else 255
+            elif cor == 0:
+                r = g = b = v[0] * escala
+                a = 255
+            elif cor == 4:
+                r = g = b = v[0] * escala
+                a = v[1] * escala
+            elif cor == 2:
+                r, g, b = v
+                a = 255
+            else:
+                r, g, b, a = v
+            pixels.append((r, g, b, a))
+    return largura, altura, pixels
+
+
+def ler_argb(caminho):
+    with open(caminho, encoding='utf-8') as f:
+        texto = re.sub(r'(#|//)[^\n]*', '', f.read())
+    valores = [int(v, 16) for v in re.findall(r'0[xX]([0-9a-fA-F]{8})\b', texto)]
+    if not valores or len(valores) % MATRIZ_PIXELS:
+        raise ErroAsset('%d valores ARGB, não é múltiplo de %d' % (len(valores), MATRIZ_PIXELS))
+    pixels = [((v >> 16) & 0xff, (v >> 8) & 0xff, v & 0xff, v >> 24) for v in valores]
+    return [pixels[i:i + MATRIZ_PIXELS] for i in range(0, len(pixels), MATRIZ_PIXELS)]
+
+
+# Agrupamento dos arquivos em animações
+
+def animacoes(pasta, extensoes):
+    """{nome: [(indice, caminho)]} em ordem de quadro"""
+    grupos = {}
+    if not os.path.isdir(pasta):
+        return grupos
+    for arquivo in sorted(os.listdir(pasta)):
+        base, ext = os.path.splitext(arquivo)
+        if ext.lower() not in extensoes:
+            continue
+        m = re.fullmatch(r'(.+)_(\d+)', base)
+        nome, indice = (m.group(1), int(m.group(2))) if m else (base, 0)
+        if not re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', nome):
+            raise ErroAsset('%s: nome não serve como identificador C' % arquivo)
+        grupos.setdefault(nome, []).append((indice, os.path.join(pasta, arquivo)))
+    for nome in grupos:
+        grupos[nome].sort()
+        indices = [i for i, _ in grupos[nome]]
+        if len(set(indices)) != len(indices):
+            raise ErroAsset('%s: quadros com o mesmo número' % nome)
+    return grupos
+
+
+# OLED: 1 bit por pixel, coluna a coluna (endereçamento vertical do SSD1306)
+
+def compilar_oled(nome, arquivos):
+    quadros = []
+    tamanho = None
+    for _, caminho in arquivos:
+        leitor = ler_png if caminho.lower().endswith('.png') else ler_pbm
+        try:
+            largura, altura, pixels = leitor(caminho)
+        except (ErroAsset, KeyError, ValueError, struct.error, zlib.error) as e:
+            raise ErroAsset('%s: %s' % (caminho, e))
+        if largura > OLED_LARGURA_MAX or altura > OLED_ALTURA_MAX:
+            raise ErroAsset('%s: %dx%d não cabe no OLED' % (caminho, largura, altura))
+        if tamanho and tamanho != (largura, altura):
+            raise ErroAsset('%s: quadros de tamanhos diferentes' % caminho)
+        tamanho = (largura, altura)
+        paginas = (altura + 7) // 8
+        dados = bytearray(largura * paginas)
+        for y in range(altura):
+            for x in range(largura):
+                r, g, b, a = pixels[y * largura + x]
+                if (r * 299 + g * 587 + b * 114) * a >= 128 * 1000 * 255:
+                    dados[x * paginas + y // 8] |= 1 << (y % 8)
+        quadros.append(bytes(dados))
+    largura, altura = tamanho
+    return {'nome': nome, 'largura': largura, 'altura': (altura + 7) // 8 * 8,
+            'dados': b''.join(quadros), 'quadros': len(quadros),
+            'fontes': [os.path.basename(c) for _, c in arquivos]}
+
+
+# Matriz: paleta ou delta, o que ficar menor
+
+def compilar_matriz(nome, arquivos):
+    quadros = []
+    for _, caminho in arquivos:
+        try:
+            if caminho.lower().endswith('.txt'):
+                lidos = ler_argb(caminho)
+            else:
+                largura, altura, pixels = ler_png(caminho)
+                if (largura, altura) != (MATRIZ_LADO, MATRIZ_LADO):
+                    raise ErroAsset('%dx%d, a matriz é %dx%d' % (largura, altura, MATRIZ_LADO, MATRIZ_LADO))
+                lidos = [pixels]
+        except (ErroAsset, KeyError, ValueError, struct.error, zlib.error) as e:
+            raise ErroAsset('%s: %s' % (caminho, e))
+        for pixels in lidos:
+            quadros.append([(r * a // 255, g * a // 255, b * a // 255) for r, g, b, a in pixels])
+    if len(quadros) > 255:
+        raise ErroAsset('%s: mais de 255 quadros' % nome)
+
+    paleta = []
+    for quadro in quadros:
+        for cor in quadro:
+            if cor not in paleta:
+                paleta.append(cor)
+    if len(paleta) > 256:
+        raise ErroAsset('%s: mais de 256 cores' % nome)
+    indices = [[paleta.index(cor) for cor in quadro] for quadro in quadros]
+    bits = 4 if len(paleta) <= 16 else 8
+
+    def completo(q):
+        if bits == 8:
+            return bytes(q)
+        return bytes(q[i] | ((q[i + 1] if i + 1 < len(q) else 0) << 4) for i in range(0, len(q), 2))
+
+    cheios = [completo(q) for q in indices]
+    deltas = [cheios[0]] + [bytes(v for p in range(MATRIZ_PIXELS) if q[p] != ant[p] for v in (p, q[p]))
+                            for ant, q in zip(indices, indices[1:])]
+    formato, partes = ('ASSET_MATRIZ_PALETA', cheios)
+    if sum(map(len, deltas)) < sum(map(len, cheios)):
+        formato, partes = ('ASSET_MATRIZ_DELTA', deltas)
+    inicio = [0]
+    for parte in partes:
+        inicio.append(inicio[-1] + len(parte))
+    return {'nome': nome, 'quadros': len(quadros), 'formato': formato, 'bits': bits, 'paleta': paleta,
+            'inicio': inicio, 'dados': b''.join(partes), 'fontes': [os.path.basename(c) for _, c in arquivos]}
+
+
+# Saída
+
+def palavras_i2c(dados, por_quadro):
+    """Cada quadro como escritas no IC_DATA_CMD: 0x40 (dados), os bytes e o STOP no último"""
+    palavras = []
+    for inicio in range(0, len(dados), por_quadro):
+        palavras += [0x40] + list(dados[inicio:inicio + por_quadro])
+        palavras[-1] |= IC_DATA_CMD_STOP
+    return palavras
+
+
+def palavras_c(palavras, recuo='    '):
+    linhas = []
+    for i in range(0, len(palavras), 12):
+        linhas.append(recuo + ', '.join('0x%04x' % p for p in palavras[i:i + 12]) + ',')
+    return '\n'.join(linhas)
+
+
+def bytes_c(dados, recuo='    '):
+    linhas = []
+    for i in range(0, len(dados), 16):
+        linhas.append(recuo + ', '.join('0x%02x' % b for b in dados[i:i + 16]) + ',')
+    return '\n'.join(linhas)
+
+
+def descrever_fontes(fontes):
+    return fontes[0] if len(fontes) == 1 else '%s ... %s' % (fontes[0], fontes[-1])
+
+
+def gerar(oled, matriz):
+    cabecalho = ['/* Gerado por assets/compilar_assets.py a partir de assets/; não editar */',
+                 '', '#ifndef ASSETS_GERADOS_H_', '#define ASSETS_GERADOS_H_', '', '#include "assets.h"', '']
+    fonte = ['/* Gerado por assets/compilar_assets.py a partir de assets/; não editar */',
+             '', '#include "assets_gerados.h"', '']
+
+    for a in oled:
+        simbolo = 'asset_oled_%s' % a['nome']
+        tela_inteira = (a['largura'], a['altura']) == (OLED_LARGURA_MAX, OLED_ALTURA_MAX)
+        tamanho = len(a['dados']) * (3 if tela_inteira else 1) + (2 * a['quadros'] if tela_inteira else 0)
+        cabecalho.append('/* oled/%s: %d quadro(s) %dx%d%s, %d bytes */' % (
+            descrever_fontes(a['fontes']), a['quadros'], a['largura'], a['altura'],
+            ' com palavras de I2C' if tela_inteira else '', tamanho))
+        cabecalho.append('extern const AssetOled %s;' % simbolo)
+        fonte += ['static const uint8_t %s_dados[] = {' % simbolo, bytes_c(a['dados']), '};', '']
+        if tela_inteira:
+            por_quadro = len(a['dados']) // a['quadros']
+            fonte += ['static const uint16_t %s_palavras[] = {' % simbolo,
+                      palavras_c(palavras_i2c(a['dados'], por_quadro)), '};', '']
+        fonte += ['const AssetOled %s = {' % simbolo,
+                  '    .nome = "%s",' % a['nome'],
+                  '    .largura = %d,' % a['largura'],
+                  '    .altura = %d,' % a['altura'],
+                  '    .quadros = %d,' % a['quadros'],
+                  '    .dados = %s_dados,' % simbolo,
+                  '    .palavras = %s,' % ('%s_palavras' % simbolo if tela_inteira else 'NULL'), '};', '']
+
+    for a in matriz:
+        simbolo = 'asset_matriz_%s' % a['nome']
+        cabecalho.append('/* matriz/%s: %d quadro(s), %d cores, %s, %d bytes */' % (
+            descrever_fontes(a['fontes']), a['quadros'], len(a['paleta']),
+            'delta' if a['formato'] == 'ASSET_MATRIZ_DELTA' else 'paleta de %d bits' % a['bits'],
+            len(a['dados']) + 3 * len(a['paleta']) + 2 * len(a['inicio'])))
+        cabecalho.append('extern const AssetMatriz %s;' % simbolo)
+        fonte += ['static const npColor_t %s_paleta[] = {' % simbolo]
+        fonte += ['    {%d, %d, %d},' % cor for cor in a['paleta']]
+        fonte += ['};', '', 'static const uint16_t %s_inicio[] = {%s};' % (simbolo, ', '.join(map(str, a['inicio']))), '',
+                  'static const uint8_t %s_dados[] = {' % simbolo, bytes_c(a['dados']), '};', '',
+                  'const AssetMatriz %s = {' % simbolo,
+                  '    .nome = "%s",' % a['nome'],
+                  '    .quadros = %d,' % a['quadros'],
+                  '    .formato = %s,' % a['formato'],
+                  '    .bits_indice = %d,' % a['bits'],
+                  '    .cores = %d,' % len(a['paleta']),
+                  '    .paleta = %s_paleta,' % simbolo,
+                  '    .inicio = %s_inicio,' % simbolo,
+                  '    .dados = %s_dados,' % simbolo, '};', '']
+
+    # Listas para procurar pelo nome
+    cabecalho += ['', '#define ASSETS_OLED_TOTAL %d' % len(oled), '#define ASSETS_MATRIZ_TOTAL %d' % len(matriz),
+                  'extern const AssetOled *const assets_oled[];', 'extern const AssetMatriz *const assets_matriz[];',
+                  '', '#endif /* ASSETS_GERADOS_H_ */', '']
+    fonte += ['const AssetOled *const assets_oled[] = {'] + ['    &asset_oled_%s,' % a['nome'] for a in oled]
+    fonte += ['    NULL,', '};', '', 'const AssetMatriz *const assets_matriz[] = {']
+    fonte += ['    &asset_matriz_%s,' % a['nome'] for a in matriz] + ['    NULL,', '};', '']
+    return '\n'.join(cabecalho), '\n'.join(fonte)
+
+
+def escrever(caminho, texto):
+    with open(caminho, 'w', encoding='utf-8') as f:
+        f.write(texto)
+
+
+def main():
+    argumentos = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    argumentos.add_argument('--fontes', required=True, help='pasta com oled/ e matriz/')
+    argumentos.add_argument('--saida', required=True, help='pasta de assets_gerados.h/.c')
+    opcoes = argumentos.parse_args()
+
+    try:
+        oled = [compilar_oled(nome, arquivos) for nome, arquivos in
+                sorted(animacoes(os.path.join(opcoes.fontes, 'oled'), ('.pbm', '.png')).items())]
+        matriz = [compilar_matriz(nome, arquivos) for nome, arquivos in
+                  sorted(animacoes(os.path.join(opcoes.fontes, 'matriz'), ('.png', '.txt')).items())]
+    except ErroAsset as e:
+        sys.exit('compilar_assets: %s' % e)
+
+    cabecalho, fonte = gerar(oled, matriz)
+    os.makedirs(opcoes.saida, exist_ok=True)
+    escrever(os.path.join(opcoes.saida, 'assets_gerados.h'), cabecalho)
+    escrever(os.path.join(opcoes.saida, 'assets_gerados.c'), fonte)
+
+
+if __name__ == '__main__':
+    main()
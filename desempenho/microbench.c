@@ -0,0 +1,278 @@
+/**
+ * @file microbench.c
+ * @brief Microbenchmarks das primitivas de desenho do OLED e da matriz de LEDs
+ *
+ * Cada caso roda em lotes até somar TEMPO_ALVO_MS e imprime uma linha JSON:
+ *
+ *     {"caso":"ssd1306_fill","plataforma":"rp2040","iteracoes":4096,"ns_por_op":...,
+ *      "ciclos_por_op":...,"ops_por_s":...,"bytes_por_op":1024,"bytes_por_s":...}
+ *
+ * bytes_por_op é o que a primitiva escreve no buffer de destino (framebuffer
+ * do OLED ou buffer/FIFO da matriz), não o tamanho da entrada.
+ *
+ * No RP2040 o tempo vem do SysTick, que conta ciclos do clock do sistema em
+ * 24 bits: cada lote é curto o bastante para não dar a volta no contador. No
+ * host (sim/) vem de CLOCK_MONOTONIC e ciclos_por_op sai null. O caso
+ * "vazio" mede o custo do laço de medição, que está incluído nos demais.
+ *
+ * Nenhuma task do FreeRTOS é criada: os números são das funções sozinhas.
+ * Na placa, npWrite espera a FIFO do PIO esvaziar, então os casos da matriz
+ * medem a taxa de 800 kHz do WS2812 e não a CPU.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "ssd1306.h"
+#include "matrizRGB.h"
+#include "assets_gerados.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#define PLATAFORMA "rp2040"
+#else
+#include <time.h>
+#define PLATAFORMA "host"
+#endif
+
+#define TEMPO_ALVO_MS 200      // Tempo total medido por caso
+#define LOTE_MAXIMO (1u << 22) // Unidades por lote (ciclos: metade da volta do SysTick)
+#define PAUSA_RODADAS_MS 5000  // Na placa, intervalo entre rodadas (para quem abrir a USB depois)
+#define MATRIZ_PINO 7          // Mesmo pino da matriz em Semaforo.c
+
+/* Relógio de medição: ciclos na placa, ns no host */
+
+#if PICO_ON_DEVICE
+
+typedef uint32_t Marca;
+
+static void relogio_iniciar(void)
+{
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // Habilitado, clock do processador, sem interrupção
+}
+
+static inline Marca marcar(void)
+{
+    return systick_hw->cvr;
+}
+
+static inline uint64_t decorrido(Marca inicio, Marca fim)
+{
+    return (inicio - fim) & 0x00FFFFFF; // Contador decrescente de 24 bits
+}
+
+static double unidades_por_s(void)
+{
+    return (double)clock_get_hz(clk_sys);
+}
+
+#else
+
+typedef uint64_t Marca;
+
+static void relogio_iniciar(void)
+{
+}
+
+static inline Marca marcar(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec;
+}
+
+static inline uint64_t decorrido(Marca inicio, Marca fim)
+{
+    return fim - inicio;
+}
+
+static double unidades_por_s(void)
+{
+    return 1e9;
+}
+
+#endif
+
+/* Casos */
+
+static ssd1306_t display;
+static const char texto[] = "AGUARDE!"; // 8 caracteres, como as mensagens do display
+static int matriz_semaforo[5][5][3];
+static CursorMatriz cursor_verde;
+
+static void caso_vazio(uint32_t i)
+{
+    (void)i;
+    __asm volatile("" ::: "memory");
+}
+
+static void caso_pixel(uint32_t i)
+{
+    ssd1306_pixel(&display, i % WIDTH, (i / WIDTH) % HEIGHT, i & 1);
+}
+
+static void caso_fill(uint32_t i)
+{
+    ssd1306_fill(&display, i & 1);
+}
+
+static void caso_char(uint32_t i)
+{
+    ssd1306_draw_char(&display, (char)(' ' + i % 95), (i * 8) % WIDTH, 24);
+}
+
+static void caso_string(uint32_t i)
+{
+    ssd1306_draw_string(&display, texto, (i & 1) * 8, 24);
+}
+
+static void caso_bitmap(uint32_t i)
+{
+    ssd1306_draw_bitmap(&display, 0, 0, asset_oled_quadro(&asset_oled_verde, i % asset_oled_verde.quadros), WIDTH, HEIGHT);
+}
+
+static void caso_line(uint32_t i)
+{
+    ssd1306_line(&display, 0, 0, WIDTH - 1, HEIGHT - 1, i & 1);
+}
+
+static void caso_matriz_intensidade(uint32_t i)
+{
+    npSetMatrixWithIntensity(matriz_semaforo, (i & 1) ? 0.5f : 0.25f);
+}
+
+static void caso_asset_matriz(uint32_t i)
+{
+    // Em sequência: cada quadro do verde (delta) só aplica os pixels que mudam
+    asset_matriz_desenhar(&cursor_verde, &asset_matriz_verde, i % asset_matriz_verde.quadros);
+}
+
+static void caso_fill_intensidade(uint32_t i)
+{
+    npFillIntensity(npColors[i % 3], 0.5f);
+}
+
+static void caso_np_write(uint32_t i)
+{
+    (void)i;
+    npWrite();
+}
+
+typedef struct
+{
+    const char *nome;
+    void (*executar)(uint32_t i);
+    uint32_t bytes_por_op;
+} Caso;
+
+static const Caso casos[] = {
+    {"vazio", caso_vazio, 0},
+    {"ssd1306_pixel", caso_pixel, 1},
+    {"ssd1306_fill", caso_fill, WIDTH * HEIGHT / 8},
+    {"ssd1306_draw_char", caso_char, 8},
+    {"ssd1306_draw_string", caso_string, 8 * (sizeof(texto) - 1)},
+    {"ssd1306_draw_bitmap", caso_bitmap, WIDTH * HEIGHT / 8},
+    {"ssd1306_line", caso_line, WIDTH}, // Diagonal: um pixel por coluna
+    {"npSetMatrixWithIntensity", caso_matriz_intensidade, NP_LED_COUNT * 3},
+    {"asset_matriz_desenhar", caso_asset_matriz, NP_LED_COUNT * 3},
+    {"npFillIntensity", caso_fill_intensidade, NP_LED_COUNT * 3},
+    {"npWrite", caso_np_write, NP_LED_COUNT * 3},
+};
+
+/**
+ * @brief Mede um caso e imprime a linha JSON
+ *
+ * O tamanho do lote dobra até o lote levar ~1/16 do alvo (sem passar de
+ * LOTE_MAXIMO unidades); depois os lotes se repetem até somar o alvo.
+ */
+static void medir(const Caso *caso)
+{
+    const double por_s = unidades_por_s();
+    const uint64_t alvo = (uint64_t)(por_s * TEMPO_ALVO_MS / 1000.0);
+    uint64_t lote_alvo = alvo / 16;
+    if (lote_alvo > LOTE_MAXIMO)
+        lote_alvo = LOTE_MAXIMO;
+
+    uint32_t n = 1;
+    uint64_t unidades;
+    while (true)
+    {
+        Marca inicio = marcar();
+        for (uint32_t i = 0; i < n; i++)
+            caso->executar(i);
+        unidades = decorrido(inicio, marcar());
+        if (unidades * 2 > lote_alvo || n >= (1u << 24))
+            break;
+        n *= 2;
+    }
+
+    uint64_t total = 0, iteracoes = 0;
+    while (total < alvo)
+    {
+        Marca inicio = marcar();
+        for (uint32_t i = 0; i < n; i++)
+            caso->executar(i);
+        total += decorrido(inicio, marcar());
+        iteracoes += n;
+    }
+
+    double s_por_op = (double)total / por_s / (double)iteracoes;
+    double ops_por_s = s_por_op > 0 ? 1.0 / s_por_op : 0;
+
+    printf("{\"caso\":\"%s\",\"plataforma\":\"%s\",\"iteracoes\":%llu,\"ns_por_op\":%.1f,", caso->nome,
+           PLATAFORMA, (unsigned long long)iteracoes, s_por_op * 1e9);
+#if PICO_ON_DEVICE
+    printf("\"ciclos_por_op\":%.1f,", (double)total / (double)iteracoes);
+#else
+    printf("\"ciclos_por_op\":null,");
+#endif
+    printf("\"ops_por_s\":%.0f,\"bytes_por_op\":%lu,\"bytes_por_s\":%.0f}\n", ops_por_s,
+           (unsigned long)caso->bytes_por_op, ops_por_s * caso->bytes_por_op);
+}
+
+static void rodar_casos(void)
+{
+    for (size_t c = 0; c < sizeof(casos) / sizeof(casos[0]); c++)
+        medir(&casos[c]);
+}
+
+int main(void)
+{
+#if PICO_ON_DEVICE
+    stdio_init_all();
+#else
+    // Sem stdio_init_all(): na simulação ela criaria a task de interrupções.
+    // As escritas do PIO iriam para o registro e dominariam o tempo do npWrite.
+    setenv("SEMAFORO_SIM_REGISTRO", "/dev/null", 0);
+    setenv("SEMAFORO_SIM_FILTRO", "-", 0);
+#endif
+
+    relogio_iniciar();
+    ssd1306_init(&display, WIDTH, HEIGHT, false, 0x3C, i2c1); // Sem tráfego: só o framebuffer
+    npInit(MATRIZ_PINO);
+    asset_matriz_ir(&cursor_verde, &asset_matriz_verde, 0);
+    for (int y = 0; y < 5; y++)
+        for (int x = 0; x < 5; x++)
+        {
+            npColor_t cor = asset_matriz_cor(&cursor_verde, x, y);
+            matriz_semaforo[y][x][0] = cor.r;
+            matriz_semaforo[y][x][1] = cor.g;
+            matriz_semaforo[y][x][2] = cor.b;
+        }
+
+#if PICO_ON_DEVICE
+    while (true)
+    {
+        sleep_ms(PAUSA_RODADAS_MS);
+        rodar_casos();
+    }
+#else
+    rodar_casos();
+    return 0;
+#endif
+}
@@ -1,142 +0,0 @@
-#include "extras/Desenho.h"
-
-int caixa_de_desenhos[23][ROWS][COLS][COLORS] = {
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 1, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 1, 0}, {0, 1, 0}, {0, 1, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 1, 0}, {0, 1, 0}, {0, 1, 0}, {0, 0, 0}},
-     {{0, 1, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 1, 0}, {0, 1, 0}, {0, 1, 0}, {0, 0, 0}},
-     {{0, 1, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 1, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 1, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {254, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {254, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}}},
-
-    {{{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {254, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {254, 0, 0}, {0, 0, 0}, {254, 0, 0}, {0, 0, 0}},
-     {{254, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {254, 0, 0}}},
-
-    {{{0, 0, 0}, {0, 0, 0}, {1, 219, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {1, 219, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {1, 219, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}},
-     {{0, 0, 0}, {0, 0, 0}, {1, 219, 0}, {0, 0, 0}, {0, 0, 0}}},
-};
\ No newline at end of file
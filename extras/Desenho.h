@@ -1,10 +0,0 @@
-#ifndef DESENHO_H
-#define DESENHO_H
-
-#define ROWS 5
-#define COLS 5
-#define COLORS 3
-
-extern int caixa_de_desenhos[23][ROWS][COLS][COLORS];
-
-#endif // DESENHO_H
\ No newline at end of file
@@ -1,409 +0,0 @@
-#include "bitmaps.h"
-#include "pico/stdlib.h"
-
-// 'Semaforo finalizado-6', 64x128px
-const unsigned char semaforo_image_6[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x08, 0xc1, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x08, 0x81,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x08, 0x81, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x08, 0x81,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x08, 0x81, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x08, 0x81,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0xf0, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x80, 0xb8,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x83, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xb8,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc4,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xff, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xff,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x83, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0x01, 0xe0, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xfd, 0xdf, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xfd, 0xbf, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0x01, 0x7f, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0x7f, 0xff, 0xfe, 0x00, 0x80, 0x01, 0xf0, 0xff, 0x7f, 0xff, 0xfd, 0x00, 0x80,
-    0x01, 0x18, 0x00, 0x00, 0xff, 0xfb, 0x01, 0x80, 0x01, 0xd8, 0xff, 0xff, 0xff, 0xf7, 0x01, 0x80,
-    0x01, 0xd8, 0xff, 0xff, 0xff, 0xef, 0x01, 0x80, 0x01, 0x1c, 0x00, 0xe0, 0xff, 0xdf, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xef, 0xff, 0xbf, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xef, 0xff, 0xbf, 0x03, 0x80,
-    0x01, 0x0c, 0x00, 0xe0, 0xff, 0xbf, 0x03, 0x80, 0x01, 0xec, 0xff, 0xff, 0xff, 0xbf, 0x03, 0x80,
-    0x01, 0xec, 0xff, 0xff, 0xff, 0xbf, 0x03, 0x80, 0x01, 0x0c, 0x00, 0xe0, 0xff, 0xbf, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xef, 0xff, 0xbf, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xef, 0xff, 0xbf, 0x03, 0x80,
-    0x01, 0x3c, 0x00, 0xe0, 0xff, 0xbf, 0x03, 0x80, 0x01, 0xb8, 0xff, 0xff, 0xff, 0xbf, 0x01, 0x80,
-    0x01, 0xb8, 0xff, 0xff, 0xff, 0xbf, 0x01, 0x80, 0x01, 0x38, 0x00, 0xe0, 0xff, 0xbf, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xef, 0xff, 0xbf, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xef, 0xff, 0xdf, 0x00, 0x80,
-    0x01, 0xe0, 0x07, 0xe0, 0xff, 0x6f, 0x00, 0x80, 0x01, 0xc0, 0xf7, 0xff, 0xff, 0x77, 0x00, 0x80,
-    0x01, 0xc0, 0xf7, 0xff, 0xff, 0x3b, 0x00, 0x80, 0x01, 0x80, 0x07, 0x00, 0x00, 0x1c, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-// 'Semaforo finalizado-4', 64x128px
-const unsigned char semaforo_image_4[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x08, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc1, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81, 0x01, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0x81, 0x01, 0x80, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0x00, 0x01, 0x80, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80, 0x01, 0xfc, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x9e,
-    0x01, 0xfc, 0x81, 0x01, 0x00, 0xf8, 0x03, 0xa1, 0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0x83, 0xff, 0xff, 0x83, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xa1, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9e,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xbf, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc0, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc0,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc0,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0xfc, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0xbf, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xa3,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xb8,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xe3, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xc4, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xe3,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xb8,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xb8, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x83,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xdf, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-// 'Semaforo finalizado-5', 64x128px
-const unsigned char semaforo_image_5[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x10, 0xc2, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x08, 0x82,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x08, 0x82, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x08, 0x82,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x10, 0xc2, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0xe0, 0xff,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x40, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x40, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc0,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x40, 0xc0, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xc0,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xc0, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0xa0,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xbf, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc4,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc4, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x80, 0xc4,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa3,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x03, 0xc0,
-    0x01, 0xfc, 0xe1, 0xe1, 0xff, 0xff, 0x83, 0xc0, 0x01, 0xfc, 0xc0, 0x00, 0x00, 0xfc, 0x83, 0xff,
-    0x01, 0x7c, 0x80, 0x00, 0x00, 0xfc, 0x03, 0xc1, 0x01, 0x7c, 0x80, 0x00, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0x7c, 0x80, 0x00, 0xff, 0xff, 0x83, 0x80, 0x01, 0x7c, 0x80, 0x00, 0x00, 0xfc, 0x83, 0x80,
-    0x01, 0xfc, 0xc0, 0x00, 0x00, 0xfc, 0x83, 0xc0, 0x01, 0xfc, 0xe1, 0xe1, 0xff, 0xff, 0x03, 0xff,
-    0x01, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x03, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0xbf,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc0,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x80, 0xc0, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc0, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xa1, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x10, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xa0, 0xb8,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x90, 0xc4, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x90, 0xc4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xc4,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x20, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xc0,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x9e,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0xa1, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc0,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x80, 0xc0, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x80, 0xc0,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xa1, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9e,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-// 'Semaforo finalizado-3', 64x128px
-const unsigned char semaforo_image_3[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x08, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc1, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81, 0x01, 0xfc, 0xff, 0x83, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0x81, 0x01, 0x00, 0xf8, 0x0b, 0x81,
-    0x01, 0xfc, 0x00, 0x01, 0x00, 0xf8, 0xf3, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80, 0x01, 0xfc, 0x00, 0x01, 0x80, 0xff, 0x03, 0x9e,
-    0x01, 0xfc, 0x81, 0x01, 0x80, 0xff, 0x03, 0xa1, 0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x83, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xa1, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9e,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xbf, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc0, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc0,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc0,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0xfc, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0xbf, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xa3,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xb8,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xe3, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xc4, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xe3,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xb8,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xb8, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x83,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xdf, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-// 'Semaforo finalizado-2', 64x128px
-const unsigned char semaforo_image_2[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x08, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc1, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81, 0x01, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0x81, 0x01, 0x80, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0x00, 0x01, 0x80, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80, 0x01, 0xfc, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x9e,
-    0x01, 0xfc, 0x81, 0x01, 0x00, 0xf8, 0x03, 0xa1, 0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0x83, 0xff, 0xff, 0x83, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xa1, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9e,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xbf, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc0, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc0,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc0,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0xfc, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0xbf, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xa3,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xb8,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xe3, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xc4, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xe3,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xb8,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xb8, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x83,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xdf, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-// 'Semaforo finalizado-1', 64x128px
-const unsigned char semaforo_image_1[] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x08, 0xc0, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc1, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0x81, 0x01, 0xfc, 0xff, 0x83, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0x81, 0x01, 0x00, 0xf8, 0x0b, 0x81,
-    0x01, 0xfc, 0x00, 0x01, 0x00, 0xf8, 0xf3, 0x80, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0x00, 0x01, 0xfe, 0xff, 0x03, 0x80, 0x01, 0xfc, 0x00, 0x01, 0x80, 0xff, 0x03, 0x9e,
-    0x01, 0xfc, 0x81, 0x01, 0x80, 0xff, 0x03, 0xa1, 0x01, 0xfc, 0xc3, 0xc3, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0x03, 0xfc, 0xff, 0x83, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc0,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xa1, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x9e,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xbf, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc0,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc0, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc0,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc0, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc0,
-    0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0xfc, 0xff,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x0f, 0x00, 0x00, 0xbf, 0x01, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xa3,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x09, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x81,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xb8,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xff, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xc0,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xe3, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x80, 0xc4, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x80, 0xc4,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80, 0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xe3,
-    0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x80, 0xc4, 0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x80, 0xc4,
-    0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x80, 0xc4, 0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x80, 0xc4,
-    0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x80, 0xc4, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xb8,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xb8, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x81, 0xc4, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc0,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80,
-    0x01, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x83, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x83,
-    0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80,
-    0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xdf, 0x01, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x80, 0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80,
-    0x01, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80,
-    0x01, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x80, 0x01, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x80,
-    0x01, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x80, 0x01, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xfe, 0x07, 0x00, 0x00, 0x80,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in= 6240)
-const int semafo_images_len = 6;
-const unsigned char *semaforo_images[6] = {
-    semaforo_image_1,
-    semaforo_image_2,
-    semaforo_image_3,
-    semaforo_image_4,
-    semaforo_image_5,
-    semaforo_image_6};
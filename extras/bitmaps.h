@@ -1,15 +0,0 @@
-#ifndef BITMAPS_H
-#define BITMAPS_H
-
-#include "pico/stdlib.h"
-
-extern const unsigned char semaforo_image_1[];
-extern const unsigned char semaforo_image_2[];
-extern const unsigned char semaforo_image_3[];
-extern const unsigned char semaforo_image_4[];
-extern const unsigned char semaforo_image_5[];
-extern const unsigned char semaforo_image_6[];
-extern const int semafo_images_len;
-extern const unsigned char *semaforo_images[];
-
-#endif // BITMAPS_H
\ No newline at end of file
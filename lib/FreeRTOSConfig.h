@@ -42,7 +42,7 @@
  
  /* Scheduler Related */
  #define configUSE_PREEMPTION                    1
- #define configUSE_TICKLESS_IDLE                 0
+ #define configUSE_TICKLESS_IDLE                 1
  #define configUSE_IDLE_HOOK                     0
  #define configUSE_TICK_HOOK                     0
  #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
@@ -135,4 +135,10 @@
  
  /* A header file that defines trace macro can be included here. */
  
+ /* Tickless idle: tempo dormindo em WFI medido por modo (lib/energia.c) */
+ void energia_antes_de_dormir( void );
+ void energia_depois_de_dormir( void );
+ #define configPRE_SLEEP_PROCESSING( xExpectedIdleTime )     energia_antes_de_dormir()
+ #define configPOST_SLEEP_PROCESSING( xExpectedIdleTime )    energia_depois_de_dormir()
+ 
  #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
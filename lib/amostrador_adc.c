@@ -0,0 +1,118 @@
+/**
+ * @file amostrador_adc.c
+ * @brief Implementação da amostragem contínua do ADC com DMA em anel
+ *
+ * O DMA escreve em modo "ring" (o endereço de escrita dá a volta sozinho),
+ * então o anel precisa estar alinhado ao seu tamanho em bytes. O índice
+ * global da última amostra é obtido do contador de transferências do canal,
+ * o que permite saber a que canal do round-robin cada posição pertence.
+ */
+
+#include "amostrador_adc.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#define ANEL_BITS_ENDERECO 9 // log2(AMOSTRADOR_ADC_TAMANHO * sizeof(uint16_t))
+#define TOTAL_TRANSFERENCIAS 0xFFFFFFFFu
+
+static uint16_t anel[AMOSTRADOR_ADC_TAMANHO] __attribute__((aligned(AMOSTRADOR_ADC_TAMANHO * sizeof(uint16_t))));
+
+static int dma_canal = -1;
+static uint8_t canais[AMOSTRADOR_ADC_NUM_CANAIS]; // Ordem do round-robin
+static uint8_t posicao_canal[AMOSTRADOR_ADC_NUM_CANAIS];
+static uint8_t num_canais = 0;
+static uint8_t mascara = 0;
+
+/**
+ * @brief (Re)inicia o ADC e o DMA a partir do primeiro canal do round-robin
+ */
+static void iniciar_transferencia(void)
+{
+    adc_run(false);
+    adc_fifo_drain();
+    adc_select_input(canais[0]);
+
+    dma_channel_set_write_addr(dma_canal, anel, false);
+    dma_channel_set_trans_count(dma_canal, TOTAL_TRANSFERENCIAS, true);
+    adc_run(true);
+}
+
+/**
+ * @brief Fim do contador de transferências (a cada vários dias): recomeça
+ */
+static void amostrador_dma_irq(void)
+{
+    if (dma_channel_get_irq0_status(dma_canal))
+    {
+        dma_channel_acknowledge_irq0(dma_canal);
+        iniciar_transferencia();
+    }
+}
+
+void amostrador_adc_iniciar(uint8_t mascara_canais, uint32_t taxa_hz)
+{
+    mascara = mascara_canais;
+    num_canais = 0;
+    for (uint8_t c = 0; c < AMOSTRADOR_ADC_NUM_CANAIS; c++)
+    {
+        if (mascara_canais & (1u << c))
+        {
+            posicao_canal[c] = num_canais;
+            canais[num_canais++] = c;
+            if (c < 4)
+                adc_gpio_init(26 + c);
+        }
+    }
+    if (num_canais == 0)
+        return;
+
+    adc_init();
+    adc_set_round_robin(mascara_canais);
+    // FIFO com DREQ a cada conversão, sem bit de erro e sem reduzir a 8 bits
+    adc_fifo_setup(true, true, 1, false, false);
+    // Período de conversão = (1 + div) ciclos do clock de 48 MHz do ADC
+    adc_set_clkdiv(48000000.0f / (float)(taxa_hz * num_canais) - 1.0f);
+
+    dma_canal = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_canal);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ANEL_BITS_ENDERECO);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(dma_canal, &c, anel, &adc_hw->fifo, TOTAL_TRANSFERENCIAS, false);
+
+    dma_channel_set_irq0_enabled(dma_canal, true);
+    irq_add_shared_handler(DMA_IRQ_0, amostrador_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    iniciar_transferencia();
+}
+
+uint16_t amostrador_adc_media(uint canal, uint n)
+{
+    if (canal >= AMOSTRADOR_ADC_NUM_CANAIS || !(mascara & (1u << canal)) || dma_canal < 0)
+        return 0;
+
+    uint32_t feitas = TOTAL_TRANSFERENCIAS - dma_hw->ch[dma_canal].transfer_count;
+    if (feitas <= posicao_canal[canal])
+        return 0; // Canal ainda não foi amostrado
+
+    // Última amostra do canal: maior k < feitas com k % num_canais == posição do canal
+    uint32_t k = feitas - 1;
+    k -= (k + num_canais - posicao_canal[canal]) % num_canais;
+
+    uint32_t maximo = AMOSTRADOR_ADC_TAMANHO / num_canais - 1; // Margem para a escrita em andamento
+    if (n > maximo)
+        n = maximo;
+    if (n > k / num_canais + 1)
+        n = k / num_canais + 1;
+
+    uint32_t soma = 0;
+    for (uint i = 0; i < n; i++)
+    {
+        soma += anel[(k - i * num_canais) % AMOSTRADOR_ADC_TAMANHO];
+    }
+    return (uint16_t)(soma / n);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file amostrador_adc.h
+ * @brief Amostragem contínua do ADC por DMA em buffer circular
+ *
+ * O ADC roda em modo livre (round-robin entre os canais habilitados) e o DMA
+ * copia cada conversão do FIFO para um anel em RAM, sem intervenção da CPU.
+ * Os consumidores apenas leem as amostras mais recentes de cada canal.
+ */
+
+#ifndef AMOSTRADOR_ADC_H_
+#define AMOSTRADOR_ADC_H_
+
+#include <stdint.h>
+#include "pico/stdlib.h"
+
+/** @brief Número de amostras no anel (potência de 2) */
+#define AMOSTRADOR_ADC_TAMANHO 256
+
+/** @brief Número de canais do ADC (4 externos + sensor de temperatura) */
+#define AMOSTRADOR_ADC_NUM_CANAIS 5
+
+/**
+ * @brief Inicia a amostragem contínua
+ *
+ * @param mascara_canais Bit n habilitado = canal n amostrado (canais 0-3 em GPIO 26-29)
+ * @param taxa_hz Taxa de amostragem de cada canal (Hz)
+ */
+void amostrador_adc_iniciar(uint8_t mascara_canais, uint32_t taxa_hz);
+
+/**
+ * @brief Média das últimas amostras de um canal
+ *
+ * @param canal Canal do ADC (0-4)
+ * @param n Número de amostras consideradas (limitado ao conteúdo do anel)
+ * @return Média em contagens de 12 bits, ou 0 se o canal não é amostrado
+ */
+uint16_t amostrador_adc_media(uint canal, uint n);
+
+#endif /* AMOSTRADOR_ADC_H_ */
@@ -0,0 +1,72 @@
+/**
+ * @file assets.c
+ * @brief Decodificação dos quadros da matriz gerados por assets/compilar_assets.py
+ */
+
+#include "assets.h"
+
+/**
+ * @brief Índices de um quadro completo
+ */
+static void ler_indices(CursorMatriz *cursor, const uint8_t *dados, uint8_t bits_indice)
+{
+    for (int pixel = 0; pixel < NP_LED_COUNT; pixel++)
+    {
+        if (bits_indice == 4)
+            cursor->indices[pixel] = (dados[pixel >> 1] >> ((pixel & 1) * 4)) & 0x0f;
+        else
+            cursor->indices[pixel] = dados[pixel];
+    }
+}
+
+/**
+ * @brief Mudanças de um quadro delta em relação ao anterior
+ */
+static void aplicar_delta(CursorMatriz *cursor, const AssetMatriz *asset, uint8_t quadro)
+{
+    const uint8_t *par = asset->dados + asset->inicio[quadro];
+    const uint8_t *fim = asset->dados + asset->inicio[quadro + 1];
+    for (; par < fim; par += 2)
+        cursor->indices[par[0]] = par[1];
+}
+
+void asset_matriz_ir(CursorMatriz *cursor, const AssetMatriz *asset, uint8_t quadro)
+{
+    if (quadro >= asset->quadros)
+        quadro = asset->quadros - 1;
+
+    if (asset->formato == ASSET_MATRIZ_PALETA)
+    {
+        ler_indices(cursor, asset->dados + asset->inicio[quadro], asset->bits_indice);
+    }
+    else
+    {
+        // Seguindo a sequência, só as mudanças; fora dela, refaz a partir do quadro 0
+        uint8_t proximo;
+        if (cursor->asset == asset && cursor->quadro <= quadro)
+            proximo = cursor->quadro + 1;
+        else
+        {
+            ler_indices(cursor, asset->dados, asset->bits_indice);
+            proximo = 1;
+        }
+        for (; proximo <= quadro; proximo++)
+            aplicar_delta(cursor, asset, proximo);
+    }
+    cursor->asset = asset;
+    cursor->quadro = quadro;
+}
+
+npColor_t asset_matriz_cor(const CursorMatriz *cursor, int x, int y)
+{
+    return cursor->asset->paleta[cursor->indices[y * NP_MATRIX_WIDTH + x]];
+}
+
+void asset_matriz_desenhar(CursorMatriz *cursor, const AssetMatriz *asset, uint8_t quadro)
+{
+    asset_matriz_ir(cursor, asset, quadro);
+    for (int y = 0; y < NP_MATRIX_HEIGHT; y++)
+        for (int x = 0; x < NP_MATRIX_WIDTH; x++)
+            npSetLED(x, y, asset_matriz_cor(cursor, x, y));
+    npWrite();
+}
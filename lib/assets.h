@@ -0,0 +1,125 @@
+/**
+ * @file assets.h
+ * @brief Imagens do OLED e quadros da matriz gerados na compilação
+ *
+ * As fontes ficam em assets/: imagens do OLED em assets/oled (PBM ou PNG)
+ * e quadros da matriz em assets/matriz (PNG 5x5 ou texto com valores
+ * 0xAARRGGBB, o mesmo formato dos literais do antigo conversor). O
+ * assets/compilar_assets.py roda a cada build em que alguma fonte mudou e
+ * gera assets_gerados.h/.c com as tabelas const abaixo, que ficam na flash.
+ *
+ * Cada arquivo é uma animação com o nome dele; "nome_N.ext" é o quadro N
+ * da animação "nome". Para acrescentar uma animação basta soltar os
+ * arquivos na pasta do dispositivo e recompilar.
+ *
+ * Os quadros já saem no formato que cada dispositivo consome:
+ *  - OLED: 1 bit por pixel, coluna a coluna, com as páginas (8 linhas,
+ *    bit 0 em cima) de cada coluna em sequência: a ordem do endereçamento
+ *    vertical que ssd1306_config() programa. Uma tela inteira é, byte a
+ *    byte, o ram_buffer do ssd1306_t. Telas inteiras saem também como as
+ *    palavras que o DMA escreve no IC_DATA_CMD do I2C (ssd1306_send_frame_dma()).
+ *  - Matriz: índices numa paleta de cores (4 bits por pixel até 16 cores,
+ *    8 bits acima disso) ou, se ficar menor, o primeiro quadro em índices e
+ *    os demais só com os pixels que mudam em relação ao anterior.
+ */
+
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include <stdint.h>
+#include "matrizRGB.h"
+
+/**
+ * @brief Animação do OLED
+ */
+typedef struct
+{
+    const char *nome;
+    uint8_t largura;      /**< Colunas */
+    uint8_t altura;       /**< Linhas, múltiplo de 8 */
+    uint8_t quadros;      /**< Quadros em dados */
+    const uint8_t *dados; /**< quadros * largura * altura / 8 bytes, coluna a coluna */
+    /**
+     * Telas inteiras (128x64): por quadro, 1 + largura * altura / 8 palavras
+     * de 16 bits, o byte de controle 0x40 e os dados, com o STOP no último.
+     * O dobro da flash de dados, para o I2C receber direto dela. NULL nas
+     * imagens menores.
+     */
+    const uint16_t *palavras;
+} AssetOled;
+
+/**
+ * @brief Codificação dos quadros da matriz
+ */
+typedef enum
+{
+    ASSET_MATRIZ_PALETA = 0, /**< Todos os quadros em índices da paleta */
+    ASSET_MATRIZ_DELTA,      /**< Quadro 0 em índices; os demais em pares (pixel, índice) */
+} FormatoAssetMatriz;
+
+/**
+ * @brief Animação da matriz 5x5
+ *
+ * Pixels contados linha a linha a partir do canto superior esquerdo
+ * (pixel = y * NP_MATRIX_WIDTH + x). Os índices de um quadro completo vão
+ * dois por byte (nibble baixo primeiro) quando bits_indice é 4.
+ */
+typedef struct
+{
+    const char *nome;
+    uint8_t quadros;
+    uint8_t formato;         /**< FormatoAssetMatriz */
+    uint8_t bits_indice;     /**< 4 ou 8 */
+    uint8_t cores;           /**< Entradas da paleta */
+    const npColor_t *paleta;
+    const uint16_t *inicio;  /**< Início de cada quadro em dados (quadros + 1 entradas) */
+    const uint8_t *dados;
+} AssetMatriz;
+
+/**
+ * @brief Quadro decodificado de uma animação da matriz
+ *
+ * Guarda o último quadro para que um quadro delta só aplique as mudanças;
+ * ir para um quadro fora da sequência refaz a partir do quadro 0.
+ */
+typedef struct
+{
+    const AssetMatriz *asset;         /**< Animação decodificada (NULL: nenhuma) */
+    uint8_t quadro;                   /**< Quadro em indices */
+    uint8_t indices[NP_LED_COUNT];    /**< Índice na paleta de cada pixel */
+} CursorMatriz;
+
+/**
+ * @brief Bytes de um quadro do OLED, direto da flash
+ */
+static inline const uint8_t *asset_oled_quadro(const AssetOled *asset, uint8_t quadro)
+{
+    return asset->dados + (uint32_t)quadro * asset->largura * (asset->altura / 8);
+}
+
+/**
+ * @brief Palavras de I2C de um quadro do OLED (NULL se não é tela inteira)
+ */
+static inline const uint16_t *asset_oled_palavras(const AssetOled *asset, uint8_t quadro)
+{
+    if (asset->palavras == NULL)
+        return NULL;
+    return asset->palavras + (uint32_t)quadro * (1u + asset->largura * (asset->altura / 8));
+}
+
+/**
+ * @brief Decodifica um quadro da matriz no cursor
+ */
+void asset_matriz_ir(CursorMatriz *cursor, const AssetMatriz *asset, uint8_t quadro);
+
+/**
+ * @brief Cor de um pixel do quadro decodificado no cursor
+ */
+npColor_t asset_matriz_cor(const CursorMatriz *cursor, int x, int y);
+
+/**
+ * @brief Decodifica um quadro, copia para a matriz e chama npWrite()
+ */
+void asset_matriz_desenhar(CursorMatriz *cursor, const AssetMatriz *asset, uint8_t quadro);
+
+#endif /* ASSETS_H_ */
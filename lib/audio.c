@@ -0,0 +1,406 @@
+/**
+ * @file audio.c
+ * @brief Implementação do motor de áudio PWM + DMA
+ *
+ * O PWM do buzzer roda com wrap de 255 (portadora de ~490 kHz, inaudível) e
+ * o nível de comparação é a própria amostra de 8 bits. Dois canais de DMA
+ * encadeados em "ping-pong" copiam os buffers para o registrador CC no ritmo
+ * de um timer de DMA. Quando um canal termina, a interrupção recarrega o
+ * buffer dele enquanto o outro toca.
+ */
+
+#include "audio.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "traco.h"
+
+#define AUDIO_PWM_WRAP 255     // Resolução de 8 bits por amostra
+#define AUDIO_NIVEL_REPOUSO 128 // Nível médio (silêncio durante a reprodução)
+
+/**
+ * @brief Tipos de trecho que compõem um sinal sonoro
+ */
+typedef enum
+{
+    SEG_FIM = 0,   // Marca o fim da lista (volta ao início)
+    SEG_TOM,       // Tom de frequência fixa
+    SEG_VARREDURA, // Varredura linear de frequência (chilreio)
+    SEG_SILENCIO,  // Pausa
+    SEG_AMOSTRA,   // Amostra ADPCM gravada na flash
+} TipoSegmento;
+
+typedef enum
+{
+    ONDA_QUADRADA = 0,
+    ONDA_SENOIDAL = 1,
+} FormaOnda;
+
+/**
+ * @brief Trecho de um sinal sonoro
+ */
+typedef struct
+{
+    uint8_t tipo;                /**< TipoSegmento */
+    uint8_t onda;                /**< FormaOnda (tons e varreduras) */
+    uint8_t volume;              /**< Volume (0-255) */
+    uint16_t duracao_ms;         /**< Duração (ignorada para amostras) */
+    uint16_t freq_inicial;       /**< Frequência em Hz */
+    uint16_t freq_final;         /**< Frequência final da varredura em Hz */
+    const AudioAmostra *amostra; /**< Amostra para SEG_AMOSTRA */
+} AudioSegmento;
+
+/* Sinais sonoros por estado do semáforo */
+static const AudioSegmento cue_verde[] = {
+    {.tipo = SEG_AMOSTRA, .volume = 255, .amostra = &audio_amostra_cuco},
+    {.tipo = SEG_SILENCIO, .duracao_ms = 200},
+    {.tipo = SEG_FIM},
+};
+
+static const AudioSegmento cue_amarelo[] = {
+    {.tipo = SEG_TOM, .onda = ONDA_QUADRADA, .volume = 200, .duracao_ms = 60, .freq_inicial = 1500},
+    {.tipo = SEG_SILENCIO, .duracao_ms = 40},
+    {.tipo = SEG_FIM},
+};
+
+static const AudioSegmento cue_vermelho[] = {
+    {.tipo = SEG_TOM, .onda = ONDA_SENOIDAL, .volume = 255, .duracao_ms = 1000, .freq_inicial = 440},
+    {.tipo = SEG_FIM},
+};
+
+static const AudioSegmento cue_noturno[] = {
+    {.tipo = SEG_VARREDURA, .onda = ONDA_SENOIDAL, .volume = 160, .duracao_ms = 150, .freq_inicial = 900, .freq_final = 600},
+    {.tipo = SEG_TOM, .onda = ONDA_SENOIDAL, .volume = 160, .duracao_ms = 850, .freq_inicial = 600},
+    {.tipo = SEG_FIM},
+};
+
+static const AudioSegmento cue_localizador[] = {
+    {.tipo = SEG_AMOSTRA, .volume = 255, .amostra = &audio_amostra_tick},
+    {.tipo = SEG_SILENCIO, .duracao_ms = 960},
+    {.tipo = SEG_FIM},
+};
+
+static const AudioSegmento *const cues[AUDIO_NUM_CUES] = {
+    [AUDIO_CUE_VERDE] = cue_verde,
+    [AUDIO_CUE_AMARELO] = cue_amarelo,
+    [AUDIO_CUE_VERMELHO] = cue_vermelho,
+    [AUDIO_CUE_NOTURNO] = cue_noturno,
+    [AUDIO_CUE_LOCALIZADOR] = cue_localizador,
+};
+
+/* Tabela de seno de 64 pontos (amplitude 127) */
+static const int8_t tabela_seno[64] = {
+    0, 12, 25, 37, 49, 60, 71, 81, 90, 98, 106, 112, 117, 122, 125, 126,
+    127, 126, 125, 122, 117, 112, 106, 98, 90, 81, 71, 60, 49, 37, 25, 12,
+    0, -12, -25, -37, -49, -60, -71, -81, -90, -98, -106, -112, -117, -122, -125, -126,
+    -127, -126, -125, -122, -117, -112, -106, -98, -90, -81, -71, -60, -49, -37, -25, -12};
+
+/* Tabelas do IMA ADPCM */
+static const int16_t adpcm_passos[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t adpcm_indices[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/* Estado do hardware */
+static uint pino_buzzer;
+static uint slice_num;
+static int dma_timer = -1;
+static int dma_canais[2] = {-1, -1};
+static uint16_t buffers[2][AUDIO_TAMANHO_BUFFER];
+
+/* Estado do gerador (acessado pela interrupção de DMA) */
+static const AudioSegmento *cue_atual = NULL;
+static const AudioSegmento *segmento = NULL;
+static uint32_t amostras_restantes = 0;
+static uint32_t fase = 0;
+static uint32_t incremento = 0;
+static int32_t delta_incremento = 0;
+static uint32_t adpcm_posicao = 0;
+static int32_t adpcm_predicao = 0;
+static int8_t adpcm_indice = 0;
+static volatile bool tocando = false;
+
+/**
+ * @brief Converte uma frequência em incremento do acumulador de fase
+ */
+static inline uint32_t incremento_da_frequencia(uint16_t freq)
+{
+    return (uint32_t)(((uint64_t)freq << 32) / AUDIO_TAXA_AMOSTRAGEM);
+}
+
+/**
+ * @brief Prepara o gerador para o trecho apontado por "segmento"
+ *
+ * Ao encontrar SEG_FIM, volta ao primeiro trecho do sinal (laço).
+ */
+static void iniciar_segmento(void)
+{
+    if (segmento->tipo == SEG_FIM)
+        segmento = cue_atual;
+
+    fase = 0;
+    delta_incremento = 0;
+
+    switch (segmento->tipo)
+    {
+    case SEG_AMOSTRA:
+        amostras_restantes = segmento->amostra->num_amostras;
+        adpcm_posicao = 0;
+        adpcm_predicao = 0;
+        adpcm_indice = 0;
+        break;
+
+    case SEG_VARREDURA:
+        amostras_restantes = (uint32_t)segmento->duracao_ms * AUDIO_TAXA_AMOSTRAGEM / 1000;
+        incremento = incremento_da_frequencia(segmento->freq_inicial);
+        if (amostras_restantes > 0)
+        {
+            int64_t final = incremento_da_frequencia(segmento->freq_final);
+            delta_incremento = (int32_t)((final - (int64_t)incremento) / (int64_t)amostras_restantes);
+        }
+        break;
+
+    default:
+        amostras_restantes = (uint32_t)segmento->duracao_ms * AUDIO_TAXA_AMOSTRAGEM / 1000;
+        incremento = incremento_da_frequencia(segmento->freq_inicial);
+        break;
+    }
+}
+
+/**
+ * @brief Decodifica a próxima amostra ADPCM do trecho atual
+ *
+ * @return Amostra de 8 bits com sinal
+ */
+static inline int32_t proxima_amostra_adpcm(void)
+{
+    uint8_t byte = segmento->amostra->dados[adpcm_posicao >> 1];
+    uint8_t codigo = (adpcm_posicao & 1) ? (byte >> 4) : (byte & 0x0F);
+    adpcm_posicao++;
+
+    int32_t passo = adpcm_passos[adpcm_indice];
+    int32_t diferenca = passo >> 3;
+    if (codigo & 4)
+        diferenca += passo;
+    if (codigo & 2)
+        diferenca += passo >> 1;
+    if (codigo & 1)
+        diferenca += passo >> 2;
+
+    adpcm_predicao += (codigo & 8) ? -diferenca : diferenca;
+    if (adpcm_predicao > 32767)
+        adpcm_predicao = 32767;
+    else if (adpcm_predicao < -32768)
+        adpcm_predicao = -32768;
+
+    adpcm_indice += adpcm_indices[codigo & 7];
+    if (adpcm_indice < 0)
+        adpcm_indice = 0;
+    else if (adpcm_indice > 88)
+        adpcm_indice = 88;
+
+    return adpcm_predicao >> 8;
+}
+
+/**
+ * @brief Preenche um buffer de DMA com as próximas amostras do sinal
+ *
+ * @param buffer Buffer de destino (níveis de PWM)
+ */
+static void gerar_amostras(uint16_t *buffer)
+{
+    for (uint i = 0; i < AUDIO_TAMANHO_BUFFER; i++)
+    {
+        while (amostras_restantes == 0)
+        {
+            segmento++;
+            iniciar_segmento();
+        }
+
+        int32_t valor;
+        switch (segmento->tipo)
+        {
+        case SEG_AMOSTRA:
+            valor = proxima_amostra_adpcm();
+            break;
+
+        case SEG_TOM:
+        case SEG_VARREDURA:
+            if (segmento->onda == ONDA_SENOIDAL)
+                valor = tabela_seno[fase >> 26];
+            else
+                valor = (fase & 0x80000000u) ? 127 : -127;
+            fase += incremento;
+            incremento += delta_incremento;
+            break;
+
+        default:
+            valor = 0;
+            break;
+        }
+
+        buffer[i] = (uint16_t)(AUDIO_NIVEL_REPOUSO + ((valor * segmento->volume) >> 8));
+        amostras_restantes--;
+    }
+}
+
+/**
+ * @brief Interrupção de fim de DMA: recarrega o buffer que acabou de tocar
+ */
+static void audio_dma_irq(void)
+{
+    for (uint i = 0; i < 2; i++)
+    {
+        if (dma_channel_get_irq0_status(dma_canais[i]))
+        {
+            dma_channel_acknowledge_irq0(dma_canais[i]);
+            if (!tocando)
+                continue;
+
+            gerar_amostras(buffers[i]);
+            dma_channel_set_read_addr(dma_canais[i], buffers[i], false);
+        }
+    }
+}
+
+/**
+ * @brief Configura um canal de DMA de áudio
+ *
+ * @param i Índice do canal (0 ou 1)
+ * @param encadear true para encadear ao outro canal (ping-pong)
+ */
+static void configurar_canal(uint i, bool encadear)
+{
+    dma_channel_config c = dma_channel_get_default_config(dma_canais[i]);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, dma_get_timer_dreq(dma_timer));
+    channel_config_set_chain_to(&c, encadear ? dma_canais[i ^ 1] : dma_canais[i]);
+
+    // Escrita de 16 bits no CC é replicada nas duas metades (canais A e B)
+    dma_channel_configure(dma_canais[i], &c, &pwm_hw->slice[slice_num].cc,
+                          buffers[i], AUDIO_TAMANHO_BUFFER, false);
+}
+
+/**
+ * @brief Para os dois canais de DMA de forma segura
+ */
+static void parar_dma(void)
+{
+    tocando = false;
+
+    // Desfaz o encadeamento antes de abortar, para que um canal não dispare o outro
+    configurar_canal(0, false);
+    configurar_canal(1, false);
+    dma_channel_abort(dma_canais[0]);
+    dma_channel_abort(dma_canais[1]);
+    dma_channel_acknowledge_irq0(dma_canais[0]);
+    dma_channel_acknowledge_irq0(dma_canais[1]);
+}
+
+/**
+ * @brief Liga ou desliga o slice PWM do buzzer
+ *
+ * Com o slice parado o nível congelaria onde estivesse, então o pino passa
+ * ao SIO em nível baixo até o próximo sinal.
+ */
+static void ligar_slice(bool ligar)
+{
+    if (ligar)
+    {
+        pwm_set_enabled(slice_num, true);
+        gpio_set_function(pino_buzzer, GPIO_FUNC_PWM);
+    }
+    else
+    {
+        gpio_put(pino_buzzer, false);
+        gpio_set_dir(pino_buzzer, GPIO_OUT);
+        gpio_set_function(pino_buzzer, GPIO_FUNC_SIO);
+        pwm_set_enabled(slice_num, false);
+    }
+}
+
+void audio_init(uint pino)
+{
+    pino_buzzer = pino;
+
+    // PWM com wrap de 8 bits e divisor 1: a portadora fica muito acima do audível
+    gpio_set_function(pino, GPIO_FUNC_PWM);
+    slice_num = pwm_gpio_to_slice_num(pino);
+
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv(&config, 1.0f);
+    pwm_config_set_wrap(&config, AUDIO_PWM_WRAP);
+    pwm_init(slice_num, &config, true);
+    pwm_set_gpio_level(pino, 0);
+
+    dma_timer = dma_claim_unused_timer(true);
+    audio_ajustar_clock();
+
+    dma_canais[0] = dma_claim_unused_channel(true);
+    dma_canais[1] = dma_claim_unused_channel(true);
+    configurar_canal(0, false);
+    configurar_canal(1, false);
+
+    irq_add_shared_handler(DMA_IRQ_0, audio_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+void audio_tocar_cue(AudioCueId cue)
+{
+    if (cue >= AUDIO_NUM_CUES)
+        return;
+
+    dma_channel_set_irq0_enabled(dma_canais[0], false);
+    dma_channel_set_irq0_enabled(dma_canais[1], false);
+    parar_dma();
+
+    cue_atual = cues[cue];
+    segmento = cue_atual;
+    iniciar_segmento();
+
+    // Os dois buffers são preenchidos antes de começar; depois só a interrupção recarrega
+    gerar_amostras(buffers[0]);
+    gerar_amostras(buffers[1]);
+    configurar_canal(0, true);
+    configurar_canal(1, true);
+
+    tocando = true;
+    ligar_slice(true);
+    dma_channel_set_irq0_enabled(dma_canais[0], true);
+    dma_channel_set_irq0_enabled(dma_canais[1], true);
+    dma_channel_start(dma_canais[0]);
+
+    traco_registrar(TRACO_BUZZER, 1u + cue);
+}
+
+void audio_parar(void)
+{
+    dma_channel_set_irq0_enabled(dma_canais[0], false);
+    dma_channel_set_irq0_enabled(dma_canais[1], false);
+    parar_dma();
+
+    // Nível baixo e slice parado: sem portadora, sem consumo no buzzer
+    pwm_set_gpio_level(pino_buzzer, 0);
+    ligar_slice(false);
+
+    traco_registrar(TRACO_BUZZER, 0);
+}
+
+bool audio_ativo(void)
+{
+    return tocando;
+}
+
+void audio_ajustar_clock(void)
+{
+    // Timer de DMA na taxa de amostragem: clk_sys * (1 / divisor)
+    dma_timer_set_fraction(dma_timer, 1, clock_get_hz(clk_sys) / AUDIO_TAXA_AMOSTRAGEM);
+}
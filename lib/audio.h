@@ -0,0 +1,89 @@
+/**
+ * @file audio.h
+ * @brief Motor de áudio para sinal sonoro acessível (PWM + DMA)
+ *
+ * Gera tons, varreduras (chilreios) e trechos de voz/efeitos amostrados no
+ * pino do buzzer. As amostras de 8 bits são escritas no registrador de
+ * comparação do PWM por DMA, cadenciado por um timer de DMA na taxa de
+ * amostragem fixa. A CPU só participa no recarregamento dos buffers
+ * (interrupção de fim de DMA), nunca amostra a amostra.
+ *
+ * As amostras gravadas ficam na flash comprimidas em IMA ADPCM de 4 bits.
+ */
+
+#ifndef AUDIO_H_
+#define AUDIO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/** @brief Taxa de amostragem do motor de áudio (Hz) */
+#define AUDIO_TAXA_AMOSTRAGEM 8000
+
+/** @brief Número de amostras em cada um dos dois buffers de DMA */
+#define AUDIO_TAMANHO_BUFFER 256
+
+/**
+ * @brief Sinais sonoros disponíveis, indexados pelo estado do semáforo
+ */
+typedef enum
+{
+    AUDIO_CUE_VERDE = 0,       // Travessia liberada (chilreio "cuco")
+    AUDIO_CUE_AMARELO,         // Atenção (bipes agudos curtos)
+    AUDIO_CUE_VERMELHO,        // Aguarde (tom grave)
+    AUDIO_CUE_NOTURNO,         // Amarelo intermitente
+    AUDIO_CUE_LOCALIZADOR,     // Tom localizador do botão ("tick")
+    AUDIO_NUM_CUES
+} AudioCueId;
+
+/**
+ * @brief Amostra gravada, comprimida em IMA ADPCM (2 amostras por byte)
+ */
+typedef struct
+{
+    const uint8_t *dados;   /**< Nibbles ADPCM, amostra par no nibble baixo */
+    uint32_t num_amostras;  /**< Número de amostras decodificadas */
+} AudioAmostra;
+
+/** @brief Amostras gravadas na flash (audio_amostras.c) */
+extern const AudioAmostra audio_amostra_tick;
+extern const AudioAmostra audio_amostra_cuco;
+
+/**
+ * @brief Inicializa o PWM, o timer de DMA e os canais de DMA do áudio
+ *
+ * @param pino Número do pino GPIO do buzzer
+ */
+void audio_init(uint pino);
+
+/**
+ * @brief Inicia a reprodução de um sinal sonoro
+ *
+ * O sinal toca em laço até audio_parar() ser chamada. Chamar novamente
+ * com outro sinal troca o sinal imediatamente.
+ *
+ * @param cue Sinal sonoro a ser reproduzido
+ */
+void audio_tocar_cue(AudioCueId cue);
+
+/**
+ * @brief Interrompe a reprodução e silencia o buzzer
+ *
+ * O slice PWM do buzzer fica desligado até o próximo sinal.
+ */
+void audio_parar(void);
+
+/**
+ * @brief Indica se há um sinal sonoro em reprodução
+ */
+bool audio_ativo(void);
+
+/**
+ * @brief Refaz o timer de DMA da taxa de amostragem com o clk_sys atual
+ *
+ * Aviso de troca de clock (lib/energia.h).
+ */
+void audio_ajustar_clock(void);
+
+#endif /* AUDIO_H_ */
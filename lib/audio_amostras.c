@@ -0,0 +1,106 @@
+/**
+ * @file audio_amostras.c
+ * @brief Amostras sonoras gravadas na flash (IMA ADPCM, 4 bits, 8 kHz)
+ *
+ * Cada byte guarda duas amostras: a primeira no nibble baixo. O preditor e
+ * o índice de passo começam em zero no início de cada amostra.
+ */
+
+#include "audio.h"
+
+// 'tick' do tom localizador, 320 amostras
+static const uint8_t amostra_tick_dados[] = {
+    0x7f, 0xff, 0xf7, 0x97, 0x7f, 0xcd, 0x97, 0x28, 0x1a, 0xc2, 0x02, 0x2b, 0xc8, 0x03, 0x4c, 0x99,
+    0xb4, 0x38, 0x0a, 0xc2, 0x12, 0x3c, 0xb8, 0x84, 0x3a, 0xb9, 0xa5, 0x38, 0x1c, 0xb2, 0x12, 0x2d,
+    0xb0, 0x84, 0x3a, 0x9b, 0x95, 0x28, 0x1c, 0xc1, 0x11, 0x3c, 0xa8, 0x03, 0x3c, 0x89, 0xa4, 0x39,
+    0x1c, 0xd3, 0x10, 0x3b, 0xb0, 0x02, 0x5b, 0x98, 0xb3, 0x38, 0x0b, 0xc5, 0x11, 0x2d, 0xa8, 0x82,
+    0x4a, 0x9a, 0xa4, 0x48, 0x0a, 0xc2, 0x11, 0x3a, 0xc0, 0x92, 0x4a, 0xa8, 0x93, 0x49, 0x8b, 0xb4,
+    0x13, 0x2e, 0xa8, 0x83, 0x4b, 0x89, 0xa4, 0x38, 0x0d, 0xc2, 0x10, 0x3a, 0xc1, 0x83, 0x3a, 0xba,
+    0xa5, 0x48, 0x0a, 0xb2, 0x20, 0x3c, 0xc0, 0x82, 0x5b, 0xa8, 0xa3, 0x28, 0x0c, 0xb3, 0x21, 0x3c,
+    0xc8, 0xa3, 0x59, 0x99, 0xa3, 0x38, 0x0d, 0xb2, 0x21, 0x3e, 0xa8, 0x03, 0x4c, 0x99, 0xb2, 0x30,
+    0x1d, 0xb2, 0x12, 0x2c, 0xb0, 0x83, 0x4c, 0x99, 0xa4, 0x20, 0x0b, 0xc2, 0x21, 0x3c, 0xb0, 0xa4,
+    0x5a, 0xa9, 0xa2, 0x38, 0x1c, 0xb3, 0x21, 0x2d, 0xb1, 0x02, 0x3c, 0xa8, 0xb4, 0x49, 0x0c, 0xc3,
+};
+
+const AudioAmostra audio_amostra_tick = {amostra_tick_dados, 320};
+
+// chilreio 'cuco' de travessia, 2400 amostras
+static const uint8_t amostra_cuco_dados[] = {
+    0x70, 0x37, 0xff, 0x7c, 0x87, 0xef, 0x53, 0xa1, 0x9e, 0x42, 0xa2, 0xad, 0x51, 0x92, 0xbc, 0x51,
+    0x82, 0xbc, 0x40, 0x84, 0xcb, 0x48, 0x03, 0xdb, 0x28, 0x14, 0xcb, 0x29, 0x15, 0xca, 0x19, 0x15,
+    0xb9, 0x1b, 0x26, 0xb9, 0x0b, 0x35, 0xc8, 0x8b, 0x34, 0xc0, 0x8b, 0x53, 0xa0, 0x9c, 0x43, 0xa1,
+    0x9d, 0x32, 0xa2, 0x9d, 0x41, 0x81, 0xac, 0x31, 0x93, 0xbc, 0x40, 0x84, 0xcb, 0x30, 0x03, 0xbc,
+    0x49, 0x04, 0xca, 0x29, 0x14, 0xba, 0x2a, 0x25, 0xca, 0x1a, 0x34, 0xc9, 0x1b, 0x24, 0xb8, 0x8c,
+    0x34, 0xc0, 0x8b, 0x53, 0xa0, 0x8c, 0x32, 0xa1, 0x9d, 0x42, 0xa1, 0x9c, 0x41, 0x92, 0xac, 0x40,
+    0x93, 0xcb, 0x40, 0x02, 0xbc, 0x30, 0x04, 0xcb, 0x28, 0x05, 0xba, 0x29, 0x15, 0xca, 0x19, 0x24,
+    0xc9, 0x1a, 0x24, 0xc9, 0x1a, 0x33, 0xc8, 0x0c, 0x43, 0xb8, 0x9b, 0x44, 0xb1, 0x9c, 0x43, 0xb1,
+    0x9c, 0x42, 0xa2, 0xac, 0x51, 0x81, 0x9c, 0x30, 0x93, 0xbc, 0x40, 0x03, 0xbc, 0x48, 0x03, 0xdb,
+    0x28, 0x14, 0xcb, 0x39, 0x23, 0xea, 0x19, 0x14, 0xb9, 0x2b, 0x34, 0xd9, 0x0a, 0x24, 0xb8, 0x0c,
+    0x43, 0xb0, 0x8c, 0x43, 0xb0, 0x8c, 0x42, 0xa1, 0xac, 0x52, 0x91, 0x9c, 0x31, 0x92, 0xbc, 0x51,
+    0x82, 0xac, 0x30, 0x03, 0xbd, 0x30, 0x04, 0xcb, 0x39, 0x05, 0xba, 0x29, 0x15, 0xca, 0x29, 0x14,
+    0xc9, 0x1a, 0x24, 0xb9, 0x0b, 0x35, 0xc8, 0x0b, 0x53, 0xa8, 0x8c, 0x33, 0xc1, 0x9b, 0x53, 0xa1,
+    0x9d, 0x32, 0xa2, 0x9d, 0x41, 0x81, 0xac, 0x31, 0x83, 0xbd, 0x40, 0x83, 0xdb, 0x20, 0x04, 0xbb,
+    0x49, 0x13, 0xdb, 0x29, 0x14, 0xc9, 0x2a, 0x24, 0xca, 0x1a, 0x24, 0xc8, 0x0a, 0x24, 0xb8, 0x0c,
+    0x43, 0xb8, 0x8c, 0x43, 0xb1, 0x9c, 0x43, 0xa1, 0x9d, 0x32, 0xa2, 0x9d, 0x41, 0x81, 0xac, 0x40,
+    0x82, 0xac, 0x30, 0x84, 0xcb, 0x30, 0x04, 0xcb, 0x39, 0x14, 0xcb, 0x39, 0x14, 0xca, 0x2a, 0x24,
+    0xd9, 0x09, 0x14, 0xb8, 0x1b, 0x34, 0xc8, 0x8b, 0x34, 0xc0, 0x8b, 0x53, 0xa0, 0x9c, 0x43, 0xb1,
+    0xab, 0x62, 0x91, 0x9c, 0x31, 0xa3, 0xbc, 0x51, 0x82, 0xac, 0x30, 0x84, 0xcb, 0x38, 0x04, 0xcb,
+    0x38, 0x04, 0xca, 0x29, 0x24, 0xda, 0x19, 0x14, 0xb9, 0x1a, 0x34, 0xd9, 0x0a, 0x24, 0xb8, 0x8b,
+    0x35, 0xb8, 0x8c, 0x43, 0xa0, 0x8d, 0x32, 0xa1, 0x9d, 0x42, 0x91, 0x9d, 0x31, 0x92, 0xac, 0x50,
+    0x92, 0xbb, 0x50, 0x02, 0xac, 0x38, 0x04, 0xcb, 0x28, 0x05, 0xba, 0x29, 0x15, 0xca, 0x29, 0x33,
+    0xda, 0x1a, 0x24, 0xc9, 0x0a, 0x34, 0xc8, 0x0b, 0x53, 0xa8, 0x8c, 0x33, 0xc1, 0x9b, 0x53, 0xa1,
+    0x9c, 0x41, 0xa2, 0x9c, 0x41, 0x92, 0xac, 0x40, 0x82, 0xac, 0x30, 0x84, 0xcb, 0x48, 0x03, 0xdb,
+    0x28, 0x04, 0xba, 0x29, 0x15, 0xba, 0x2a, 0x25, 0xca, 0x1a, 0x24, 0xc8, 0x1b, 0x24, 0xb8, 0x8c,
+    0x34, 0xc0, 0x8b, 0x53, 0xa0, 0x8c, 0x32, 0xa1, 0x9d, 0x51, 0x91, 0x9c, 0x31, 0x92, 0xbc, 0x51,
+    0x82, 0xac, 0x30, 0x03, 0xbd, 0x30, 0x04, 0xcb, 0x28, 0x05, 0xba, 0x29, 0x15, 0xca, 0x29, 0x33,
+    0xda, 0x1a, 0x24, 0xc9, 0x0a, 0x34, 0xc8, 0x0b, 0x53, 0xa8, 0x8c, 0x33, 0xc1, 0x9b, 0x53, 0xa1,
+    0xac, 0x52, 0x91, 0x9c, 0x31, 0x92, 0xbc, 0x51, 0x92, 0xbb, 0x50, 0x02, 0xbc, 0x30, 0x04, 0xcb,
+    0x28, 0x05, 0xba, 0x29, 0x15, 0xca, 0x29, 0x33, 0xea, 0x09, 0x24, 0xb9, 0x1b, 0x34, 0xc8, 0x0c,
+    0x33, 0xc0, 0x8b, 0x53, 0xa0, 0x9c, 0x43, 0xb1, 0x9c, 0x42, 0xa2, 0xac, 0x51, 0x91, 0xab, 0x41,
+    0x93, 0xbc, 0x40, 0x03, 0xbc, 0x38, 0x05, 0xcb, 0x38, 0x04, 0xca, 0x29, 0x14, 0xca, 0x29, 0x14,
+    0xc9, 0x1a, 0x24, 0xc8, 0x1b, 0x24, 0xc8, 0x8a, 0x84, 0x80, 0x00, 0x88, 0x80, 0x00, 0x08, 0x88,
+    0x00, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0x88, 0x00, 0x88,
+    0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0xfd, 0xef, 0x46, 0x92, 0xdd, 0x19,
+    0x44, 0x91, 0xcc, 0x19, 0x44, 0x91, 0xcc, 0x19, 0x34, 0xa2, 0xcc, 0x2a, 0x44, 0x91, 0xcc, 0x08,
+    0x34, 0x91, 0xcc, 0x19, 0x34, 0x91, 0xbd, 0x19, 0x35, 0x91, 0xad, 0x2a, 0x34, 0x91, 0xbd, 0x19,
+    0x44, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x18, 0x43, 0x91, 0xbc, 0x19,
+    0x44, 0x91, 0xbc, 0x19, 0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x18, 0x43, 0xa2, 0xbc, 0x2a, 0x44, 0x91, 0xbc, 0x19,
+    0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x19, 0x25, 0x91, 0xcb, 0x19,
+    0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19,
+    0x44, 0x91, 0xbc, 0x19, 0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x19,
+    0x44, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x25, 0xa2, 0xdb, 0x19, 0x34, 0x90, 0xdb, 0x19,
+    0x34, 0xa1, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x08, 0x24, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xcc, 0x19,
+    0x34, 0x91, 0xad, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x35, 0xa1, 0xbc, 0x19, 0x35, 0x91, 0xcc, 0x08,
+    0x24, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xad, 0x2a, 0x53, 0x91, 0xbc, 0x18, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x44, 0x91, 0xbc, 0x19,
+    0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x19, 0x44, 0x80, 0xac, 0x19,
+    0x43, 0x91, 0xbc, 0x19, 0x25, 0xa2, 0xdb, 0x19, 0x34, 0x90, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x19,
+    0x34, 0x90, 0xcb, 0x19, 0x34, 0x91, 0xcc, 0x19, 0x34, 0x91, 0xad, 0x19, 0x53, 0x80, 0xac, 0x19,
+    0x43, 0x91, 0xbc, 0x19, 0x44, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x18, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x44, 0x91, 0xbc, 0x19, 0x25, 0x91, 0xcb, 0x19,
+    0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x19, 0x44, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19,
+    0x25, 0x91, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x19, 0x34, 0x90, 0xcb, 0x19,
+    0x34, 0x91, 0xcc, 0x19, 0x34, 0x91, 0xad, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x35, 0xa1, 0xbc, 0x19,
+    0x35, 0x91, 0xcc, 0x08, 0x24, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x18, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x18, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x91, 0xbc, 0x29, 0x53, 0x80, 0xac, 0x19,
+    0x43, 0x91, 0xbc, 0x19, 0x44, 0x91, 0xbc, 0x19, 0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29,
+    0x34, 0x91, 0xbd, 0x19, 0x44, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x25, 0x91, 0xdb, 0x19,
+    0x34, 0xa1, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x19, 0x34, 0x90, 0xcb, 0x19, 0x34, 0x91, 0xcc, 0x19,
+    0x34, 0x91, 0xad, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x35, 0xa1, 0xbc, 0x19, 0x35, 0x91, 0xad, 0x19,
+    0x43, 0x91, 0xbc, 0x19, 0x35, 0xa1, 0xbc, 0x29, 0x34, 0xa2, 0xbd, 0x19, 0x25, 0x91, 0xdb, 0x19,
+    0x34, 0xa1, 0xdb, 0x19, 0x34, 0xa1, 0xdb, 0x08, 0x24, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xcc, 0x19,
+    0x34, 0x91, 0xad, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x35, 0xa1, 0xbc, 0x19, 0x35, 0x91, 0xcc, 0x08,
+    0x24, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xad, 0x2a, 0x53, 0x91, 0xbc, 0x18, 0x53, 0x91, 0xbc, 0x29,
+    0x53, 0x91, 0xbc, 0x29, 0x53, 0x80, 0xac, 0x19, 0x43, 0x91, 0xbc, 0x19, 0x44, 0x91, 0xbc, 0x19,
+    0x25, 0x91, 0xcb, 0x19, 0x34, 0x91, 0xbd, 0x29, 0x34, 0x91, 0xbd, 0x19, 0x44, 0x80, 0xac, 0x19,
+};
+
+const AudioAmostra audio_amostra_cuco = {amostra_cuco_dados, 2400};
@@ -0,0 +1,628 @@
+/**
+ * @file barramento_i2c.c
+ * @brief Implementação do gerenciador do barramento I2C
+ */
+
+#include "barramento_i2c.h"
+#include "relogio.h"
+#include "prioridades.h"
+#include "perfil_barramento.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/gpio.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef enum
+{
+    TRANSACAO_ESCRITA = 0, /**< Curta, em curta */
+    TRANSACAO_PEDACOS,     /**< Longa, em dados, com prefixo em cada pedaço */
+    TRANSACAO_PALAVRAS,    /**< Palavras prontas do IC_DATA_CMD, em dados */
+    TRANSACAO_LEITURA,     /**< Registro em curta, bytes lidos em destino */
+} TipoTransacao;
+
+typedef struct
+{
+    uint8_t tipo;
+    uint8_t prefixo;
+    uint8_t tamanho_curta;
+    uint8_t curta[BARRAMENTO_I2C_CURTA];
+    const void *dados;
+    uint8_t *destino;
+    uint16_t tamanho; // Bytes (pedaços, leitura) ou palavras
+    uint16_t enviado; // Bytes de dados já no fio (pedaços)
+    uint32_t pedido_us;
+} TransacaoI2C;
+
+typedef struct
+{
+    uint8_t endereco;
+    uint8_t prioridade;
+    uint8_t preterido; // Vezes que ficou de fora desde a última vez servido
+    AvisoBarramentoI2C aviso;
+    void *contexto;
+    TransacaoI2C fila[BARRAMENTO_I2C_FILA];
+    uint8_t cabeca;              // Transação em andamento (só a task do barramento avança)
+    volatile uint8_t pendentes;  // Enfileiradas e ainda não concluídas
+    uint32_t pausa_ms;           // Pausa da última falha (0: sem falha desde o último sucesso)
+    uint64_t retomar_us;         // Fim da pausa
+    EstatisticasI2C estatisticas;
+} DispositivoI2C;
+
+static i2c_inst_t *porta = NULL;
+static int canal = -1;
+static TaskHandle_t tarefa = NULL;
+static DispositivoI2C dispositivos[BARRAMENTO_I2C_MAX_DISPOSITIVOS];
+static uint8_t num_dispositivos = 0;
+static int ultimo = -1;       // Último dispositivo servido (início do rodízio)
+static int endereco_tar = -1; // Endereço no TAR do I2C (-1: desconhecido)
+static int no_fio = -1;       // Dispositivo cujo último pedaço ainda não foi conferido
+static uint pino_sda, pino_scl;
+static uint baudrate_i2c;
+static uint32_t recuperacoes = 0;
+
+// Pedaço em palavras de 16 bits: uma escrita de 8 bits no IC_DATA_CMD seria
+// replicada nos bits de CMD/STOP/RESTART
+static uint16_t palavras_pedaco[1 + BARRAMENTO_I2C_PEDACO];
+
+static void barramento_i2c_irq(void)
+{
+    if (canal < 0 || !dma_channel_get_irq0_status(canal))
+        return;
+    dma_channel_acknowledge_irq0(canal);
+    BaseType_t acordar = pdFALSE;
+    vTaskNotifyGiveFromISR(tarefa, &acordar);
+    portYIELD_FROM_ISR(acordar);
+}
+
+static DispositivoI2C *dispositivo_de(int dispositivo)
+{
+    if (dispositivo < 0 || dispositivo >= num_dispositivos)
+        return NULL;
+    return &dispositivos[dispositivo];
+}
+
+/**
+ * @brief O dispositivo está em pausa depois de uma falha (chamar em seção crítica)
+ */
+static bool em_pausa(const DispositivoI2C *d, uint64_t agora_us)
+{
+    return d->pausa_ms > 0 && agora_us < d->retomar_us;
+}
+
+/**
+ * @brief Copia a transação para o fim da fila, esperando vaga se preciso
+ *
+ * Recusa na hora se o dispositivo está em pausa.
+ */
+static bool enfileirar(int dispositivo, const TransacaoI2C *transacao)
+{
+    DispositivoI2C *d = dispositivo_de(dispositivo);
+    if (d == NULL)
+        return false;
+    for (;;)
+    {
+        taskENTER_CRITICAL();
+        if (em_pausa(d, relogio_us()))
+        {
+            d->estatisticas.descartadas++;
+            taskEXIT_CRITICAL();
+            return false;
+        }
+        if (d->pendentes < BARRAMENTO_I2C_FILA)
+        {
+            TransacaoI2C *t = &d->fila[(d->cabeca + d->pendentes) % BARRAMENTO_I2C_FILA];
+            *t = *transacao;
+            t->pedido_us = (uint32_t)relogio_us();
+            d->pendentes++;
+            taskEXIT_CRITICAL();
+            break;
+        }
+        taskEXIT_CRITICAL();
+        vTaskDelay(1);
+    }
+    xTaskNotifyGive(tarefa);
+    return true;
+}
+
+// A maior transação aceita (UINT16_MAX bytes ou palavras) tem prazo em 32 bits até a 100 kHz
+_Static_assert((UINT16_MAX + 1ull) * 18000000ull / 100000u + BARRAMENTO_I2C_FOLGA_US <= UINT32_MAX,
+               "prazo da maior transacao nao cabe em 32 bits");
+
+/**
+ * @brief Prazo de uma transferência de n bytes: o dobro do tempo de fio, mais folga
+ *
+ * O dobro cobre o clock stretching de um escravo lento; além disso o
+ * barramento é dado por preso. Em 64 bits: no RP2040 size_t tem 32, e um
+ * quadro inteiro (1025 palavras) estouraria o produto.
+ */
+static uint32_t prazo_us(size_t n)
+{
+    // 2 * 9 bits por byte (8 + ACK), mais o byte de endereço
+    uint64_t prazo = ((uint64_t)n + 1u) * 18000000ull / baudrate_i2c + BARRAMENTO_I2C_FOLGA_US;
+    return prazo > UINT32_MAX ? UINT32_MAX : (uint32_t)prazo;
+}
+
+/**
+ * @brief Espera o último pedaço sair do FIFO e do fio, até o prazo de um FIFO cheio
+ *
+ * @return false se o controlador continua ativo: barramento preso
+ */
+static bool esperar_fio(void)
+{
+    i2c_hw_t *hw = i2c_get_hw(porta);
+    uint64_t limite = relogio_us() + prazo_us(16);
+    while (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS))
+    {
+        if (relogio_us() >= limite)
+            return false;
+        busy_wait_us(2);
+    }
+    return true;
+}
+
+/**
+ * @brief Lê e limpa um aborto de transmissão do controlador
+ *
+ * Depois de um aborto o FIFO fica descartando o que chega até o
+ * IC_CLR_TX_ABRT ser lido.
+ */
+static ResultadoI2C ler_aborto(void)
+{
+    i2c_hw_t *hw = i2c_get_hw(porta);
+    if (!(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS))
+        return I2C_OK;
+    uint32_t fonte = hw->tx_abrt_source;
+    (void)hw->clr_tx_abrt;
+    if (fonte & (I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS | I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS))
+        return I2C_NACK;
+    return I2C_ABORTO;
+}
+
+/**
+ * @brief Devolve SDA e SCL ao I2C, com pull-ups
+ */
+static void configurar_porta(void)
+{
+    i2c_init(porta, baudrate_i2c);
+    gpio_set_function(pino_sda, GPIO_FUNC_I2C);
+    gpio_set_function(pino_scl, GPIO_FUNC_I2C);
+    gpio_pull_up(pino_sda);
+    gpio_pull_up(pino_scl);
+}
+
+/**
+ * @brief Solta um escravo que segura o SDA e reinicia o controlador
+ *
+ * O escravo parou no meio de um byte esperando clock: com os pinos como
+ * GPIO em dreno aberto (saída em 0 para puxar, entrada com pull-up para
+ * soltar), até 9 pulsos de SCL levam o byte ao fim, e um STOP (SDA sobe
+ * com SCL alto) devolve o barramento ao repouso.
+ */
+static void recuperar_barramento(void)
+{
+    dma_channel_abort(canal);
+    i2c_deinit(porta);
+
+    gpio_init(pino_sda);
+    gpio_init(pino_scl);
+    gpio_pull_up(pino_sda);
+    gpio_pull_up(pino_scl);
+    for (int i = 0; i < 9 && !gpio_get(pino_sda); i++)
+    {
+        gpio_set_dir(pino_scl, GPIO_OUT);
+        busy_wait_us(5);
+        gpio_set_dir(pino_scl, GPIO_IN);
+        busy_wait_us(5);
+    }
+    gpio_set_dir(pino_scl, GPIO_OUT);
+    gpio_set_dir(pino_sda, GPIO_OUT);
+    busy_wait_us(5);
+    gpio_set_dir(pino_scl, GPIO_IN);
+    busy_wait_us(5);
+    gpio_set_dir(pino_sda, GPIO_IN);
+    busy_wait_us(5);
+
+    configurar_porta();
+    endereco_tar = -1;
+    no_fio = -1;
+    recuperacoes++;
+}
+
+/**
+ * @brief Perde a transação em andamento e o resto da fila e põe o dispositivo em pausa
+ *
+ * O resto depende da transação perdida (a janela vem antes dos dados),
+ * então vai junto; o driver refaz tudo depois da pausa.
+ */
+static void falhar(int indice, ResultadoI2C resultado)
+{
+    DispositivoI2C *d = &dispositivos[indice];
+    if (resultado != I2C_NACK)
+        recuperar_barramento();
+
+    taskENTER_CRITICAL();
+    d->estatisticas.falhas++;
+    if (resultado == I2C_NACK)
+        d->estatisticas.nacks++;
+    else
+        d->estatisticas.tempos++;
+    if (d->pendentes > 1)
+        d->estatisticas.descartadas += d->pendentes - 1u;
+    d->cabeca = (d->cabeca + d->pendentes) % BARRAMENTO_I2C_FILA;
+    d->pendentes = 0;
+    d->pausa_ms = d->pausa_ms ? d->pausa_ms * 2u : BARRAMENTO_I2C_PAUSA_MIN_MS;
+    if (d->pausa_ms > BARRAMENTO_I2C_PAUSA_MAX_MS)
+        d->pausa_ms = BARRAMENTO_I2C_PAUSA_MAX_MS;
+    d->retomar_us = relogio_us() + (uint64_t)d->pausa_ms * 1000u;
+    taskEXIT_CRITICAL();
+
+    if (d->aviso != NULL)
+        d->aviso(d->contexto, resultado);
+}
+
+/**
+ * @brief Confere o último pedaço do dispositivo no fio
+ *
+ * Uma escrita curta cabe no FIFO: o canal termina antes de o endereço
+ * sair, e um NACK aparece depois. Ele é do último dispositivo no fio, e é
+ * visto aqui antes de outro usar o barramento ou quando a task fica ociosa.
+ *
+ * @return false se o último pedaço falhou
+ */
+static bool conferir_fio(void)
+{
+    if (no_fio < 0)
+        return true;
+    int indice = no_fio;
+    no_fio = -1;
+    ResultadoI2C resultado = esperar_fio() ? ler_aborto() : I2C_TEMPO;
+    if (resultado == I2C_OK)
+        return true;
+    falhar(indice, resultado);
+    return false;
+}
+
+/**
+ * @brief Põe as palavras no fio por DMA e espera o canal terminar, até o prazo
+ *
+ * Pedaços seguidos do mesmo dispositivo vão sem esperar o fio; o TAR só
+ * muda com o I2C desabilitado, então a troca de dispositivo espera o
+ * pedaço anterior sair inteiro.
+ */
+static ResultadoI2C enviar_dma(DispositivoI2C *d, const uint16_t *palavras, size_t quantidade)
+{
+    if (endereco_tar != d->endereco)
+    {
+        if (!esperar_fio())
+            return I2C_TEMPO;
+        i2c_hw_t *hw = i2c_get_hw(porta);
+        hw->enable = 0;
+        hw->tar = d->endereco;
+        hw->enable = 1;
+        endereco_tar = d->endereco;
+    }
+
+    uint64_t inicio = perfil_barramento_marcar();
+    uint64_t limite = relogio_us() + prazo_us(quantidade);
+    dma_channel_set_read_addr(canal, palavras, false);
+    dma_channel_set_trans_count(canal, quantidade, true);
+    while (dma_channel_is_busy(canal))
+    {
+        uint64_t agora = relogio_us();
+        if (agora >= limite)
+        {
+            dma_channel_abort(canal);
+            return I2C_TEMPO;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((uint32_t)((limite - agora) / 1000u)) + 1);
+    }
+    perfil_barramento_registrar(BARRAMENTO_I2C, quantidade, inicio);
+
+    d->estatisticas.pedacos++;
+    d->estatisticas.bytes += quantidade;
+    return ler_aborto();
+}
+
+/**
+ * @brief Lê com a escrita do registro antes, cada parte com prazo
+ */
+static ResultadoI2C ler(DispositivoI2C *d, const TransacaoI2C *t)
+{
+    // O SDK troca o TAR por conta própria; leituras são curtas e raras
+    if (!esperar_fio())
+        return I2C_TEMPO;
+    endereco_tar = d->endereco;
+    uint64_t inicio = perfil_barramento_marcar();
+    int r = PICO_OK;
+    if (t->tamanho_curta > 0)
+        r = i2c_write_timeout_us(porta, d->endereco, t->curta, t->tamanho_curta, true, prazo_us(t->tamanho_curta));
+    if (r >= 0)
+        r = i2c_read_timeout_us(porta, d->endereco, t->destino, t->tamanho, false, prazo_us(t->tamanho));
+    perfil_barramento_registrar(BARRAMENTO_I2C, t->tamanho_curta + t->tamanho, inicio);
+    if (r == PICO_ERROR_TIMEOUT)
+        return I2C_TEMPO;
+    if (r < 0)
+        return I2C_NACK;
+    d->estatisticas.pedacos++;
+    d->estatisticas.bytes += t->tamanho_curta + t->tamanho;
+    return I2C_OK;
+}
+
+/**
+ * @brief Monta um pedaço em palavras, com o prefixo (se >= 0) e STOP no último byte
+ */
+static size_t alargar(int prefixo, const uint8_t *dados, size_t tamanho)
+{
+    size_t n = 0;
+    if (prefixo >= 0)
+        palavras_pedaco[n++] = (uint8_t)prefixo;
+    for (size_t i = 0; i < tamanho; i++)
+        palavras_pedaco[n++] = dados[i];
+    palavras_pedaco[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return n;
+}
+
+/**
+ * @brief Escolhe o próximo dispositivo: prioridade mais envelhecimento, rodízio nos empates
+ *
+ * @return Índice, ou -1 se nenhum tem transação pendente
+ */
+static int escolher(void)
+{
+    int melhor = -1;
+    uint32_t maior = 0;
+    for (uint8_t i = 1; i <= num_dispositivos; i++)
+    {
+        int indice = (ultimo + i) % num_dispositivos;
+        const DispositivoI2C *d = &dispositivos[indice];
+        if (d->pendentes == 0)
+            continue;
+        uint32_t efetiva = (uint32_t)d->prioridade + d->preterido;
+        if (melhor < 0 || efetiva > maior)
+        {
+            melhor = indice;
+            maior = efetiva;
+        }
+    }
+
+    for (uint8_t i = 0; i < num_dispositivos; i++)
+    {
+        DispositivoI2C *d = &dispositivos[i];
+        if (i == melhor)
+            d->preterido = 0;
+        else if (d->pendentes > 0 && d->preterido < UINT8_MAX)
+            d->preterido++;
+    }
+    return melhor;
+}
+
+/**
+ * @brief Põe no fio um pedaço da transação em andamento do dispositivo
+ */
+static void servir(int indice)
+{
+    DispositivoI2C *d = &dispositivos[indice];
+    TransacaoI2C *t = &d->fila[d->cabeca];
+
+    // O pedaço anterior de outro dispositivo sai inteiro antes da troca. Uma
+    // leitura confere sempre: o SDK limparia o aborto de uma escrita ainda no
+    // fio, e se ela falhou a fila (com a leitura) já foi descartada
+    if (no_fio != indice || t->tipo == TRANSACAO_LEITURA)
+    {
+        conferir_fio();
+        if (d->pendentes == 0)
+            return;
+    }
+    bool concluida = true;
+    ResultadoI2C resultado = I2C_OK;
+
+    if (t->tipo != TRANSACAO_PEDACOS || t->enviado == 0)
+    {
+        uint32_t espera = (uint32_t)relogio_us() - t->pedido_us;
+        if (espera > d->estatisticas.espera_max_us)
+            d->estatisticas.espera_max_us = espera;
+    }
+
+    switch (t->tipo)
+    {
+    case TRANSACAO_ESCRITA:
+        resultado = enviar_dma(d, palavras_pedaco, alargar(-1, t->curta, t->tamanho_curta));
+        break;
+
+    case TRANSACAO_PEDACOS:
+    {
+        size_t n = t->tamanho - t->enviado;
+        if (n > BARRAMENTO_I2C_PEDACO)
+            n = BARRAMENTO_I2C_PEDACO;
+        resultado = enviar_dma(d, palavras_pedaco, alargar(t->prefixo, (const uint8_t *)t->dados + t->enviado, n));
+        t->enviado += n;
+        concluida = t->enviado >= t->tamanho;
+        break;
+    }
+
+    case TRANSACAO_PALAVRAS:
+        resultado = enviar_dma(d, t->dados, t->tamanho);
+        break;
+
+    case TRANSACAO_LEITURA:
+        resultado = ler(d, t);
+        break;
+
+    default:
+        break;
+    }
+
+    if (resultado != I2C_OK)
+    {
+        no_fio = -1;
+        falhar(indice, resultado);
+        return;
+    }
+    no_fio = t->tipo == TRANSACAO_LEITURA ? -1 : indice;
+    if (!concluida)
+        return;
+    taskENTER_CRITICAL();
+    d->cabeca = (d->cabeca + 1) % BARRAMENTO_I2C_FILA;
+    d->pendentes--;
+    bool vazia = d->pendentes == 0;
+    d->pausa_ms = 0;
+    taskEXIT_CRITICAL();
+    d->estatisticas.transacoes++;
+    if (vazia && d->aviso != NULL)
+        d->aviso(d->contexto, I2C_OK);
+}
+
+/**
+ * @brief Task do barramento: um pedaço por vez, escolhendo de novo entre eles
+ */
+static void tarefa_barramento(void *parametro)
+{
+    (void)parametro;
+    for (;;)
+    {
+        int indice = escolher();
+        if (indice < 0)
+        {
+            // Um pedido feito depois da escolha deixa a notificação pendente.
+            // O último pedaço é conferido quando já saiu do FIFO (< 1 ms)
+            if (no_fio >= 0)
+            {
+                if (ulTaskNotifyTake(pdTRUE, 1) == 0)
+                    conferir_fio();
+                continue;
+            }
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        servir(indice);
+        ultimo = indice;
+    }
+}
+
+void barramento_i2c_iniciar(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate)
+{
+    porta = i2c;
+    pino_sda = sda;
+    pino_scl = scl;
+    baudrate_i2c = baudrate;
+    configurar_porta();
+    canal = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(canal);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+    dma_channel_configure(canal, &c, &i2c_get_hw(i2c)->data_cmd, NULL, 0, false);
+
+    dma_channel_set_irq0_enabled(canal, true);
+    irq_add_shared_handler(DMA_IRQ_0, barramento_i2c_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    xTaskCreate(tarefa_barramento, "I2C", configMINIMAL_STACK_SIZE, NULL, prioridades_de(PAPEL_BARRAMENTO), &tarefa);
+    prioridades_registrar(PAPEL_BARRAMENTO, tarefa);
+}
+
+int barramento_i2c_registrar(uint8_t endereco, uint8_t prioridade, AvisoBarramentoI2C aviso, void *contexto)
+{
+    if (num_dispositivos >= BARRAMENTO_I2C_MAX_DISPOSITIVOS)
+        return -1;
+    DispositivoI2C *d = &dispositivos[num_dispositivos];
+    memset(d, 0, sizeof(*d));
+    d->endereco = endereco;
+    d->prioridade = prioridade;
+    d->aviso = aviso;
+    d->contexto = contexto;
+    return num_dispositivos++;
+}
+
+bool barramento_i2c_escrever(int dispositivo, const uint8_t *dados, size_t tamanho)
+{
+    if (tamanho == 0 || tamanho > BARRAMENTO_I2C_CURTA)
+        return false;
+    TransacaoI2C t = {.tipo = TRANSACAO_ESCRITA, .tamanho_curta = (uint8_t)tamanho};
+    memcpy(t.curta, dados, tamanho);
+    return enfileirar(dispositivo, &t);
+}
+
+bool barramento_i2c_escrever_pedacos(int dispositivo, uint8_t prefixo, const uint8_t *dados, size_t tamanho)
+{
+    if (tamanho == 0 || tamanho > UINT16_MAX)
+        return false;
+    TransacaoI2C t = {.tipo = TRANSACAO_PEDACOS, .prefixo = prefixo, .dados = dados, .tamanho = (uint16_t)tamanho};
+    return enfileirar(dispositivo, &t);
+}
+
+bool barramento_i2c_palavras(int dispositivo, const uint16_t *palavras, size_t quantidade)
+{
+    if (quantidade == 0 || quantidade > UINT16_MAX)
+        return false;
+    TransacaoI2C t = {.tipo = TRANSACAO_PALAVRAS, .dados = palavras, .tamanho = (uint16_t)quantidade};
+    return enfileirar(dispositivo, &t);
+}
+
+bool barramento_i2c_ler(int dispositivo, const uint8_t *registro, size_t tamanho_registro, uint8_t *destino,
+                        size_t tamanho)
+{
+    if (tamanho_registro > BARRAMENTO_I2C_CURTA || tamanho == 0 || tamanho > UINT16_MAX)
+        return false;
+    TransacaoI2C t = {.tipo = TRANSACAO_LEITURA, .tamanho_curta = (uint8_t)tamanho_registro, .destino = destino,
+                      .tamanho = (uint16_t)tamanho};
+    memcpy(t.curta, registro, tamanho_registro);
+    return enfileirar(dispositivo, &t);
+}
+
+bool barramento_i2c_ocupado(int dispositivo)
+{
+    const DispositivoI2C *d = dispositivo_de(dispositivo);
+    return d != NULL && d->pendentes > 0;
+}
+
+uint32_t barramento_i2c_pausa_ms(int dispositivo)
+{
+    const DispositivoI2C *d = dispositivo_de(dispositivo);
+    if (d == NULL)
+        return 0;
+    taskENTER_CRITICAL();
+    uint64_t agora = relogio_us();
+    uint32_t restante = em_pausa(d, agora) ? (uint32_t)((d->retomar_us - agora + 999u) / 1000u) : 0;
+    taskEXIT_CRITICAL();
+    return restante;
+}
+
+void barramento_i2c_estatisticas(int dispositivo, EstatisticasI2C *estatisticas)
+{
+    const DispositivoI2C *d = dispositivo_de(dispositivo);
+    if (d == NULL)
+    {
+        memset(estatisticas, 0, sizeof(*estatisticas));
+        return;
+    }
+    taskENTER_CRITICAL();
+    *estatisticas = d->estatisticas;
+    taskEXIT_CRITICAL();
+}
+
+uint32_t barramento_i2c_recuperacoes(void)
+{
+    return recuperacoes;
+}
+
+void barramento_i2c_imprimir_estatisticas(void)
+{
+    for (uint8_t i = 0; i < num_dispositivos; i++)
+    {
+        EstatisticasI2C e;
+        barramento_i2c_estatisticas(i, &e);
+        printf("i2c: 0x%02x prioridade=%u transacoes=%lu pedacos=%lu bytes=%lu espera_max_us=%lu\n",
+               dispositivos[i].endereco, dispositivos[i].prioridade, (unsigned long)e.transacoes,
+               (unsigned long)e.pedacos, (unsigned long)e.bytes, (unsigned long)e.espera_max_us);
+        printf("i2c: 0x%02x falhas=%lu nacks=%lu tempos=%lu descartadas=%lu pausa_ms=%lu\n",
+               dispositivos[i].endereco, (unsigned long)e.falhas, (unsigned long)e.nacks, (unsigned long)e.tempos,
+               (unsigned long)e.descartadas, (unsigned long)barramento_i2c_pausa_ms(i));
+    }
+    printf("i2c: recuperacoes=%lu\n", (unsigned long)recuperacoes);
+}
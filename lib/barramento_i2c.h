@@ -0,0 +1,186 @@
+/**
+ * @file barramento_i2c.h
+ * @brief Gerenciador do barramento I2C: uma task, filas por dispositivo e DMA
+ *
+ * Vários dispositivos (displays, sensores) dividem um mesmo I2C. Em vez de
+ * cada driver chamar i2c_write_blocking() da sua task, os drivers
+ * enfileiram transações no seu dispositivo e voltam sem esperar; a task do
+ * barramento é a única que toca o I2C e as entrega, por DMA (palavras de 16
+ * bits no IC_DATA_CMD, STOP na última).
+ *
+ * Escritas longas vão em pedaços de até BARRAMENTO_I2C_PEDACO bytes, cada
+ * um uma transação I2C com o mesmo prefixo (o byte de controle 0x40 do
+ * SSD1306, que continua a escrita de onde parou). Entre dois pedaços a task
+ * escolhe de novo o dispositivo:
+ *  - o de maior prioridade com transação pendente;
+ *  - cada vez que um dispositivo pendente é preterido, ganha um ponto de
+ *    prioridade até ser servido (envelhecimento): nenhum fica sem vez;
+ *  - entre empatados, o rodízio começa depois do último servido.
+ * Assim dois displays atualizando regiões ao mesmo tempo se alternam
+ * pedaço a pedaço, e um envio grande não segura um sensor por ~25 ms.
+ *
+ * Quando a fila de um dispositivo esvazia, o aviso dele é chamado na task
+ * do barramento (não pode bloquear nem enfileirar no próprio dispositivo),
+ * com o resultado: concluída ou a falha que descartou a fila.
+ *
+ * Nenhuma transferência espera mais que o tempo de fio com folga:
+ *  - NACK (dispositivo ausente ou desligado): a transação e o resto da
+ *    fila do dispositivo são descartados (dependem dela: janela e dados);
+ *  - tempo esgotado ou aborto do controlador (barramento preso, escravo
+ *    segurando o SDA): o mesmo, e o barramento é recuperado com até 9
+ *    pulsos de SCL pelos pinos como GPIO, um STOP e o I2C reiniciado.
+ * Cada falha põe o dispositivo em pausa, que dobra a cada falha seguida
+ * (BARRAMENTO_I2C_PAUSA_MIN_MS a BARRAMENTO_I2C_PAUSA_MAX_MS): na pausa as
+ * transações novas são recusadas na hora, então um display morto custa um
+ * byte de endereço a cada 10 s e não segura quem chama. A primeira
+ * transação depois da pausa é a tentativa; um sucesso zera a pausa. O
+ * driver, que vê as falhas em EstatisticasI2C, reconfigura o dispositivo
+ * (ele pode ter reiniciado).
+ *
+ * Depois que o escalonador começa, só a task do barramento escreve no I2C:
+ * as configurações iniciais (escritas diretas, com tempo limite) vêm antes.
+ */
+
+#ifndef BARRAMENTO_I2C_H_
+#define BARRAMENTO_I2C_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "hardware/i2c.h"
+
+/** @brief Dispositivos no barramento */
+#define BARRAMENTO_I2C_MAX_DISPOSITIVOS 6
+
+/** @brief Transações pendentes por dispositivo */
+#define BARRAMENTO_I2C_FILA 8
+
+/** @brief Bytes de uma escrita curta (copiada para a fila) */
+#define BARRAMENTO_I2C_CURTA 16
+
+/** @brief Bytes de dados de cada pedaço de uma escrita longa */
+#define BARRAMENTO_I2C_PEDACO 128
+
+/** @brief Pausa de um dispositivo depois da primeira falha */
+#define BARRAMENTO_I2C_PAUSA_MIN_MS 20
+
+/** @brief Pausa máxima, depois de falhas seguidas */
+#define BARRAMENTO_I2C_PAUSA_MAX_MS 10000
+
+/** @brief Folga sobre o dobro do tempo de fio antes de dar o barramento por preso */
+#define BARRAMENTO_I2C_FOLGA_US 2000
+
+/**
+ * @brief Resultado de uma transação
+ */
+typedef enum
+{
+    I2C_OK = 0,
+    I2C_NACK,   /**< Endereço ou dado sem ACK: dispositivo ausente */
+    I2C_ABORTO, /**< Outro aborto do controlador (perda de arbitragem, por exemplo) */
+    I2C_TEMPO,  /**< A transferência passou do prazo: barramento preso */
+} ResultadoI2C;
+
+/**
+ * @brief Aviso de fila vazia, na task do barramento
+ *
+ * @param resultado I2C_OK se a última transação foi concluída; senão a
+ *                  falha que a perdeu, e com ela o resto da fila (uma
+ *                  leitura não preencheu o destino)
+ */
+typedef void (*AvisoBarramentoI2C)(void *contexto, ResultadoI2C resultado);
+
+/**
+ * @brief Medidas de um dispositivo
+ */
+typedef struct
+{
+    uint32_t transacoes;    /**< Transações concluídas */
+    uint32_t pedacos;       /**< Transações I2C no fio */
+    uint32_t bytes;         /**< Bytes no fio, prefixos incluídos */
+    uint32_t espera_max_us; /**< Maior espera do pedido até o primeiro byte */
+    uint32_t falhas;        /**< Transações perdidas (cada uma inicia uma pausa) */
+    uint32_t nacks;         /**< ... por NACK */
+    uint32_t tempos;        /**< ... por tempo esgotado ou aborto (com recuperação) */
+    uint32_t descartadas;   /**< Transações descartadas com a fila ou recusadas na pausa */
+} EstatisticasI2C;
+
+/**
+ * @brief Inicializa o I2C e os pinos, reserva o canal de DMA e cria a task
+ *
+ * Chamar antes de vTaskStartScheduler(). Os pinos são guardados para a
+ * recuperação do barramento.
+ */
+void barramento_i2c_iniciar(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate);
+
+/**
+ * @brief Acrescenta um dispositivo
+ *
+ * @param endereco Endereço de 7 bits
+ * @param prioridade Maior é servido antes
+ * @param aviso Chamado quando a fila esvazia (pode ser NULL)
+ * @return Identificador do dispositivo, ou -1 se não há espaço
+ */
+int barramento_i2c_registrar(uint8_t endereco, uint8_t prioridade, AvisoBarramentoI2C aviso, void *contexto);
+
+/**
+ * @brief Enfileira uma escrita curta (até BARRAMENTO_I2C_CURTA bytes, copiados)
+ *
+ * Como as demais, espera se a fila do dispositivo está cheia.
+ *
+ * @return false se o dispositivo ou o tamanho é inválido, ou se o
+ *         dispositivo está em pausa (a transação não foi enfileirada)
+ */
+bool barramento_i2c_escrever(int dispositivo, const uint8_t *dados, size_t tamanho);
+
+/**
+ * @brief Enfileira uma escrita longa, em pedaços que começam com prefixo
+ *
+ * dados não é copiado: deve ficar intacto até barramento_i2c_ocupado()
+ * ficar falso.
+ */
+bool barramento_i2c_escrever_pedacos(int dispositivo, uint8_t prefixo, const uint8_t *dados, size_t tamanho);
+
+/**
+ * @brief Enfileira uma escrita já em palavras do IC_DATA_CMD (STOP na última)
+ *
+ * Vai inteira por DMA, sem cópia (as telas de lib/assets.h vão direto da
+ * flash), então ocupa o barramento até o fim.
+ */
+bool barramento_i2c_palavras(int dispositivo, const uint16_t *palavras, size_t quantidade);
+
+/**
+ * @brief Enfileira uma leitura: escreve registro e lê tamanho bytes em destino
+ *
+ * registro até BARRAMENTO_I2C_CURTA bytes (copiado); destino vale depois
+ * de um aviso com I2C_OK.
+ */
+bool barramento_i2c_ler(int dispositivo, const uint8_t *registro, size_t tamanho_registro, uint8_t *destino,
+                        size_t tamanho);
+
+/**
+ * @brief O dispositivo tem transações pendentes ou em andamento
+ */
+bool barramento_i2c_ocupado(int dispositivo);
+
+/**
+ * @brief ms até o fim da pausa do dispositivo (0: aceita transações)
+ */
+uint32_t barramento_i2c_pausa_ms(int dispositivo);
+
+/**
+ * @brief Cópia das medidas de um dispositivo
+ */
+void barramento_i2c_estatisticas(int dispositivo, EstatisticasI2C *estatisticas);
+
+/**
+ * @brief Recuperações do barramento desde o início
+ */
+uint32_t barramento_i2c_recuperacoes(void);
+
+/**
+ * @brief Imprime uma linha por dispositivo e as recuperações
+ */
+void barramento_i2c_imprimir_estatisticas(void);
+
+#endif /* BARRAMENTO_I2C_H_ */
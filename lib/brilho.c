@@ -0,0 +1,75 @@
+/**
+ * @file brilho.c
+ * @brief Implementação do brilho adaptativo
+ */
+
+#include "brilho.h"
+#include "amostrador_adc.h"
+
+/** @brief Amostras do anel em cada leitura do sensor */
+#define AMOSTRAS_LEITURA 8
+
+// Brilho em 9 pontos igualmente espaçados da luz filtrada (sobe rápido no escuro, onde o olho é mais sensível)
+static const uint8_t curva[9] = {BRILHO_MINIMO, 64, 104, 140, 172, 200, 224, 242, 255};
+
+static uint32_t acumulador = 0; // Luz filtrada << BRILHO_FILTRO_SHIFT
+static bool filtro_iniciado = false;
+static volatile uint8_t publicado = 255;
+static uint32_t ultima_troca_ms = 0;
+
+/**
+ * @brief Brilho da curva para uma luz de 12 bits (interpolação linear)
+ */
+static uint8_t brilho_da_luz(uint16_t luz)
+{
+    uint32_t posicao = (uint32_t)luz * (8u << 9) / 4095u; // 0 a 8.0 em 23.9
+    uint32_t trecho = posicao >> 9;
+    uint32_t fracao = posicao & 0x1ff;
+    if (trecho >= 8)
+        return curva[8];
+    return (uint8_t)(curva[trecho] + (((int32_t)curva[trecho + 1] - curva[trecho]) * (int32_t)fracao >> 9));
+}
+
+bool brilho_atualizar(uint32_t agora_ms)
+{
+#if BRILHO_SENSOR_LUZ
+    uint16_t amostra = amostrador_adc_media(BRILHO_CANAL_LUZ, AMOSTRAS_LEITURA);
+
+    // IIR: y += (x - y) / 2^SHIFT, sem divisão; a primeira leitura carrega o filtro
+    if (!filtro_iniciado)
+    {
+        acumulador = (uint32_t)amostra << BRILHO_FILTRO_SHIFT;
+        filtro_iniciado = true;
+        ultima_troca_ms = agora_ms - BRILHO_INTERVALO_MS;
+    }
+    else
+        acumulador = acumulador - (acumulador >> BRILHO_FILTRO_SHIFT) + amostra;
+
+    uint8_t novo = brilho_da_luz(brilho_luz());
+    int diferenca = (int)novo - (int)publicado;
+    if (diferenca < 0)
+        diferenca = -diferenca;
+
+    // Histerese, exceto para chegar aos extremos da curva
+    bool extremo = (novo == BRILHO_MINIMO || novo == 255) && novo != publicado;
+    if ((diferenca < BRILHO_HISTERESE && !extremo) || agora_ms - ultima_troca_ms < BRILHO_INTERVALO_MS)
+        return false;
+
+    publicado = novo;
+    ultima_troca_ms = agora_ms;
+    return true;
+#else
+    (void)agora_ms;
+    return false;
+#endif
+}
+
+uint8_t brilho_atual(void)
+{
+    return publicado;
+}
+
+uint16_t brilho_luz(void)
+{
+    return (uint16_t)(acumulador >> BRILHO_FILTRO_SHIFT);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file brilho.h
+ * @brief Brilho das saídas conforme a luz ambiente
+ *
+ * Um sensor de luz (LDR em divisor de tensão, mais luz = mais tensão) num
+ * canal livre do ADC é lido do anel do amostrador a cada BRILHO_AMOSTRA_MS
+ * e suavizado por um filtro IIR de primeira ordem em ponto fixo. Uma curva
+ * por trechos leva a luz filtrada ao brilho global (BRILHO_MINIMO a 255),
+ * aplicado da mesma forma ao LED RGB, à tabela de brilho da matriz e ao
+ * contraste do SSD1306.
+ *
+ * O brilho publicado só muda quando o novo valor se afasta BRILHO_HISTERESE
+ * do atual e no máximo uma vez a cada BRILHO_INTERVALO_MS; assim a luz
+ * oscilando perto de um limiar não gera escritas nos periféricos.
+ */
+
+#ifndef BRILHO_H_
+#define BRILHO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Canal do ADC com o sensor de luz (GPIO 28), -1 sem sensor */
+#ifndef BRILHO_CANAL_LUZ
+#define BRILHO_CANAL_LUZ 2
+#endif
+
+/** @brief Há sensor de luz; sem ele o brilho fica em 255 */
+#define BRILHO_SENSOR_LUZ (BRILHO_CANAL_LUZ >= 0)
+
+/** @brief Intervalo entre amostras do sensor */
+#define BRILHO_AMOSTRA_MS 250
+
+/** @brief Peso da amostra nova no filtro: 1 / 2^BRILHO_FILTRO_SHIFT (~4 s com 250 ms) */
+#define BRILHO_FILTRO_SHIFT 4
+
+/** @brief Brilho no escuro (0-255) */
+#define BRILHO_MINIMO 24
+
+/** @brief Menor diferença que troca o brilho publicado */
+#define BRILHO_HISTERESE 8
+
+/** @brief Menor intervalo entre duas trocas do brilho publicado */
+#define BRILHO_INTERVALO_MS 2000
+
+/**
+ * @brief Lê o sensor, filtra e atualiza o brilho publicado
+ *
+ * @param agora_ms Tempo atual (relogio_ms())
+ * @return true se o brilho publicado mudou
+ */
+bool brilho_atualizar(uint32_t agora_ms);
+
+/**
+ * @brief Brilho publicado (0-255); pode ser lido de qualquer task
+ */
+uint8_t brilho_atual(void);
+
+/**
+ * @brief Luz ambiente filtrada, em contagens de 12 bits
+ */
+uint16_t brilho_luz(void);
+
+#endif /* BRILHO_H_ */
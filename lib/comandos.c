@@ -0,0 +1,85 @@
+/**
+ * @file comandos.c
+ * @brief Implementação da fila de comandos do controlador
+ */
+
+#include "comandos.h"
+#include "queue.h"
+#include <stdio.h>
+
+static QueueHandle_t fila = NULL;
+static TaskHandle_t tarefa_controlador = NULL;
+static EstatisticasComando estatisticas[NUM_TIPOS_COMANDO]; // Só o controlador escreve
+static volatile uint32_t descartados = 0;
+
+static const char *const nomes_comando[NUM_TIPOS_COMANDO] = {"alternar_modo", "definir_modo", "pedestre",
+                                                              "preempcao", "status"};
+
+void comandos_iniciar(TaskHandle_t controlador)
+{
+    fila = xQueueCreate(COMANDOS_TAMANHO_FILA, sizeof(Comando));
+    tarefa_controlador = controlador;
+}
+
+bool comandos_enviar(const Comando *comando)
+{
+    if (xQueueSend(fila, comando, 0) != pdTRUE)
+    {
+        descartados++;
+        return false;
+    }
+    xTaskNotifyGive(tarefa_controlador);
+    return true;
+}
+
+bool comandos_enviar_de_isr(const Comando *comando, BaseType_t *acordar)
+{
+    if (xQueueSendFromISR(fila, comando, acordar) != pdTRUE)
+    {
+        descartados++;
+        return false;
+    }
+    vTaskNotifyGiveFromISR(tarefa_controlador, acordar);
+    return true;
+}
+
+bool comandos_receber(Comando *comando)
+{
+    return xQueueReceive(fila, comando, 0) == pdTRUE;
+}
+
+void comandos_concluir(const Comando *comando, uint64_t agora_us)
+{
+    EstatisticasComando *e = &estatisticas[comando->tipo];
+    uint32_t latencia = (uint32_t)(agora_us - comando->instante_us);
+
+    e->concluidos++;
+    e->ultima_us = latencia;
+    e->soma_us += latencia;
+    if (latencia > e->maxima_us)
+        e->maxima_us = latencia;
+}
+
+void comandos_estatisticas(TipoComando tipo, EstatisticasComando *saida)
+{
+    *saida = estatisticas[tipo];
+}
+
+void comandos_imprimir_estatisticas(void)
+{
+    for (int t = 0; t < NUM_TIPOS_COMANDO; t++)
+    {
+        const EstatisticasComando *e = &estatisticas[t];
+        if (e->concluidos == 0)
+            continue;
+        printf("comandos: %s n=%lu ultima_us=%lu media_us=%lu max_us=%lu\n", nomes_comando[t],
+               (unsigned long)e->concluidos, (unsigned long)e->ultima_us,
+               (unsigned long)(e->soma_us / e->concluidos), (unsigned long)e->maxima_us);
+    }
+    printf("comandos: descartados=%lu\n", (unsigned long)descartados);
+}
+
+const char *comandos_nome(TipoComando tipo)
+{
+    return (tipo < NUM_TIPOS_COMANDO) ? nomes_comando[tipo] : "?";
+}
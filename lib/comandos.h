@@ -0,0 +1,111 @@
+/**
+ * @file comandos.h
+ * @brief Fila de comandos do controlador
+ *
+ * Toda entrada externa (botão de modo, botoeira, preempção, console serial)
+ * vira um comando tipado postado nesta fila. Só a task do controlador
+ * consome a fila, e só nos pontos seguros do seu laço: entre duas
+ * atualizações do motor de fases, nunca no meio de uma transição. Quem
+ * posta não escreve estado do controlador, então uma entrada nova é só mais
+ * um tipo de comando, sem outra variável compartilhada nem outra varredura.
+ *
+ * Cada comando leva o instante em que a entrada aconteceu (a borda, para
+ * entradas com debounce); ao concluí-lo o controlador registra a latência
+ * desde esse instante, por tipo de comando.
+ */
+
+#ifndef COMANDOS_H_
+#define COMANDOS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/** @brief Comandos pendentes antes de novas postagens serem recusadas */
+#define COMANDOS_TAMANHO_FILA 8
+
+typedef enum
+{
+    COMANDO_ALTERNAR_MODO = 0, /**< Normal <-> noturno */
+    COMANDO_DEFINIR_MODO,      /**< argumento: ModoOperacao */
+    COMANDO_CHAMADA_PEDESTRE,  /**< argumento: grupo de pedestres */
+    COMANDO_PREEMPCAO,         /**< Veículo de emergência */
+    COMANDO_STATUS,            /**< Imprime as latências dos comandos */
+    NUM_TIPOS_COMANDO,
+} TipoComando;
+
+typedef enum
+{
+    ORIGEM_BOTAO = 0,
+    ORIGEM_BOTOEIRA,
+    ORIGEM_PREEMPCAO,
+    ORIGEM_CONSOLE,
+} OrigemComando;
+
+typedef struct
+{
+    TipoComando tipo;
+    OrigemComando origem;
+    uint8_t argumento;
+    uint64_t instante_us; /**< Quando a entrada aconteceu (time_us_64) */
+} Comando;
+
+/**
+ * @brief Latências entrada -> comando concluído (µs)
+ */
+typedef struct
+{
+    uint32_t concluidos;
+    uint32_t ultima_us;
+    uint32_t maxima_us;
+    uint64_t soma_us; /**< Para a média: soma_us / concluidos */
+} EstatisticasComando;
+
+/**
+ * @brief Cria a fila
+ *
+ * @param controlador Task notificada a cada comando postado
+ */
+void comandos_iniciar(TaskHandle_t controlador);
+
+/**
+ * @brief Posta um comando sem bloquear (tasks)
+ *
+ * @return false se a fila está cheia (o comando é descartado e contado)
+ */
+bool comandos_enviar(const Comando *comando);
+
+/**
+ * @brief Posta um comando de um handler de interrupção
+ *
+ * @param acordar Recebe pdTRUE se o controlador deve rodar na saída da interrupção
+ */
+bool comandos_enviar_de_isr(const Comando *comando, BaseType_t *acordar);
+
+/**
+ * @brief Retira o próximo comando, sem bloquear (só o controlador)
+ */
+bool comandos_receber(Comando *comando);
+
+/**
+ * @brief Registra a latência de um comando já executado
+ */
+void comandos_concluir(const Comando *comando, uint64_t agora_us);
+
+/**
+ * @brief Copia as latências de um tipo de comando
+ */
+void comandos_estatisticas(TipoComando tipo, EstatisticasComando *saida);
+
+/**
+ * @brief Imprime uma linha por tipo de comando já concluído
+ */
+void comandos_imprimir_estatisticas(void);
+
+/**
+ * @brief Nome curto do tipo (para mensagens)
+ */
+const char *comandos_nome(TipoComando tipo);
+
+#endif /* COMANDOS_H_ */
@@ -0,0 +1,410 @@
+/**
+ * @file compositor.c
+ * @brief Camadas do OLED e envio das regiões sujas (ver compositor.h)
+ */
+
+#include "compositor.h"
+#include <string.h>
+
+/**
+ * @brief Região com as colunas e páginas tocadas por um retângulo em pixels
+ */
+static RegiaoTela regiao_de(const Compositor *compositor, RetanguloTela area)
+{
+    uint8_t x1 = area.x + area.largura - 1;
+    uint8_t y1 = area.y + area.altura - 1;
+    if (x1 >= compositor->ssd->width)
+        x1 = compositor->ssd->width - 1;
+    if (y1 >= compositor->ssd->height)
+        y1 = compositor->ssd->height - 1;
+    return (RegiaoTela){area.x, x1, area.y / 8, y1 / 8};
+}
+
+static RegiaoTela unir(RegiaoTela a, RegiaoTela b)
+{
+    return (RegiaoTela){
+        a.x0 < b.x0 ? a.x0 : b.x0,
+        a.x1 > b.x1 ? a.x1 : b.x1,
+        a.pagina0 < b.pagina0 ? a.pagina0 : b.pagina0,
+        a.pagina1 > b.pagina1 ? a.pagina1 : b.pagina1,
+    };
+}
+
+static uint32_t bytes_regiao(RegiaoTela r)
+{
+    return (uint32_t)(r.x1 - r.x0 + 1) * (r.pagina1 - r.pagina0 + 1);
+}
+
+/**
+ * @brief Regiões que se cruzam ou encostam: enviar juntas não custa mais
+ */
+static bool encostam(RegiaoTela a, RegiaoTela b)
+{
+    return a.x0 <= b.x1 + 1 && b.x0 <= a.x1 + 1 &&
+           a.pagina0 <= b.pagina1 + 1 && b.pagina0 <= a.pagina1 + 1;
+}
+
+static void marcar(Compositor *compositor, RegiaoTela regiao)
+{
+    // Absorve as regiões que encostam, até não sobrar nenhuma
+    for (int i = 0; i < compositor->num_regioes;)
+    {
+        if (encostam(compositor->regioes[i], regiao))
+        {
+            regiao = unir(regiao, compositor->regioes[i]);
+            compositor->regioes[i] = compositor->regioes[--compositor->num_regioes];
+            i = 0;
+        }
+        else
+            i++;
+    }
+
+    // Sem espaço, une com a região que menos cresce
+    if (compositor->num_regioes == COMPOSITOR_MAX_REGIOES)
+    {
+        int melhor = 0;
+        uint32_t menor = UINT32_MAX;
+        for (int i = 0; i < compositor->num_regioes; i++)
+        {
+            uint32_t crescimento = bytes_regiao(unir(compositor->regioes[i], regiao)) - bytes_regiao(compositor->regioes[i]);
+            if (crescimento < menor)
+            {
+                menor = crescimento;
+                melhor = i;
+            }
+        }
+        regiao = unir(regiao, compositor->regioes[melhor]);
+        compositor->regioes[melhor] = compositor->regioes[--compositor->num_regioes];
+        marcar(compositor, regiao);
+        return;
+    }
+    compositor->regioes[compositor->num_regioes++] = regiao;
+}
+
+static void marcar_camada(Compositor *compositor, const CamadaTela *camada)
+{
+    marcar(compositor, regiao_de(compositor, camada->area));
+}
+
+static CamadaTela *camada_de(Compositor *compositor, int camada)
+{
+    if (camada < 0 || camada >= compositor->num_camadas)
+        return NULL;
+    return &compositor->camadas[camada];
+}
+
+void compositor_init(Compositor *compositor, ssd1306_t *ssd)
+{
+    memset(compositor, 0, sizeof(*compositor));
+    compositor->ssd = ssd;
+}
+
+int compositor_adicionar(Compositor *compositor, TipoCamada tipo, uint8_t x, uint8_t y, uint8_t largura, uint8_t altura)
+{
+    if (compositor->num_camadas == COMPOSITOR_MAX_CAMADAS || largura == 0 || altura == 0)
+        return -1;
+    CamadaTela *camada = &compositor->camadas[compositor->num_camadas];
+    memset(camada, 0, sizeof(*camada));
+    camada->tipo = tipo;
+    camada->area = (RetanguloTela){x, y, largura, altura};
+    return compositor->num_camadas++;
+}
+
+void compositor_fundo(Compositor *compositor, const AssetOled *fundo, uint8_t quadro)
+{
+    const AssetOled *anterior = compositor->fundo;
+    uint8_t quadro_anterior = compositor->quadro_fundo;
+    if (anterior == fundo && quadro_anterior == quadro)
+        return;
+    compositor->fundo = fundo;
+    compositor->quadro_fundo = quadro;
+    if (anterior == NULL)
+    {
+        compositor_invalidar(compositor);
+        return;
+    }
+
+    // Só o retângulo em volta dos bytes que mudaram (coluna a coluna, como no ram_buffer)
+    const uint8_t *antes = asset_oled_quadro(anterior, quadro_anterior);
+    const uint8_t *depois = asset_oled_quadro(fundo, quadro);
+    uint8_t paginas = compositor->ssd->pages;
+    RegiaoTela mudou = {UINT8_MAX, 0, UINT8_MAX, 0};
+    bool algum = false;
+    for (uint8_t x = 0; x < compositor->ssd->width; x++)
+    {
+        for (uint8_t pagina = 0; pagina < paginas; pagina++)
+        {
+            uint16_t i = x * paginas + pagina;
+            if (antes[i] == depois[i])
+                continue;
+            mudou = unir(mudou, (RegiaoTela){x, x, pagina, pagina});
+            algum = true;
+        }
+    }
+    if (algum)
+        marcar(compositor, mudou);
+}
+
+void compositor_texto(Compositor *compositor, int camada, const char *texto)
+{
+    CamadaTela *c = camada_de(compositor, camada);
+    if (c == NULL || strncmp(c->texto, texto, COMPOSITOR_MAX_TEXTO) == 0)
+        return;
+    strncpy(c->texto, texto, COMPOSITOR_MAX_TEXTO);
+    c->texto[COMPOSITOR_MAX_TEXTO] = '\0';
+    if (c->visivel)
+        marcar_camada(compositor, c);
+}
+
+void compositor_sprite(Compositor *compositor, int camada, const uint8_t *bitmap)
+{
+    CamadaTela *c = camada_de(compositor, camada);
+    if (c == NULL || c->sprite == bitmap)
+        return;
+    c->sprite = bitmap;
+    if (c->visivel)
+        marcar_camada(compositor, c);
+}
+
+void compositor_barra(Compositor *compositor, int camada, uint32_t valor, uint32_t maximo)
+{
+    CamadaTela *c = camada_de(compositor, camada);
+    if (c == NULL)
+        return;
+    // A barra só é reenviada quando uma coluna muda, não a cada valor novo
+    uint8_t interior = c->area.largura > 2 ? c->area.largura - 2 : 0;
+    if (valor > maximo)
+        valor = maximo;
+    uint8_t preenchido = maximo ? (uint8_t)((uint64_t)interior * valor / maximo) : 0;
+    if (preenchido == c->preenchido)
+        return;
+    c->preenchido = preenchido;
+    if (c->visivel)
+        marcar_camada(compositor, c);
+}
+
+void compositor_mostrar(Compositor *compositor, int camada, bool visivel)
+{
+    CamadaTela *c = camada_de(compositor, camada);
+    if (c == NULL || c->visivel == visivel)
+        return;
+    c->visivel = visivel;
+    marcar_camada(compositor, c);
+}
+
+void compositor_invalidar(Compositor *compositor)
+{
+    compositor->num_regioes = 0;
+    marcar(compositor, (RegiaoTela){0, compositor->ssd->width - 1, 0, compositor->ssd->pages - 1});
+}
+
+void compositor_reiniciado(Compositor *compositor)
+{
+    // ssd1306_config() deixa o painel sem rolagem, sem inversão e na linha 0;
+    // o letreiro pedido e os efeitos em andamento são reaplicados daí
+    compositor->letreiro_ativo = false;
+    compositor->invertido = false;
+    compositor->linha_inicial = 0;
+    compositor_invalidar(compositor);
+}
+
+/**
+ * @brief Pixel de uma camada, em coordenadas relativas ao retângulo dela
+ */
+static bool pixel_camada(const CamadaTela *camada, uint8_t dx, uint8_t dy)
+{
+    switch (camada->tipo)
+    {
+    case CAMADA_TEXTO:
+    {
+        // Texto centrado na vertical, com a mesma margem à esquerda
+        uint8_t margem = camada->area.altura > 8 ? (camada->area.altura - 8) / 2 : 0;
+        if (dx < margem || dy < margem || dy >= margem + 8)
+            return false;
+        uint8_t coluna = dx - margem;
+        size_t caractere = coluna / 8;
+        if (caractere >= strlen(camada->texto))
+            return false;
+        return (ssd1306_glyph(camada->texto[caractere])[coluna % 8] >> (dy - margem)) & 1;
+    }
+    case CAMADA_SPRITE:
+        if (camada->sprite == NULL)
+            return false;
+        return (camada->sprite[dx * (camada->area.altura / 8) + dy / 8] >> (dy % 8)) & 1;
+    case CAMADA_BARRA:
+        if (dx == 0 || dy == 0 || dx == camada->area.largura - 1 || dy == camada->area.altura - 1)
+            return true;
+        return dx - 1 < camada->preenchido;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Refaz uma região no ram_buffer: fundo e, por cima, as camadas visíveis
+ */
+static void compor(Compositor *compositor, RegiaoTela regiao)
+{
+    ssd1306_t *ssd = compositor->ssd;
+    const uint8_t *fundo = compositor->fundo ? asset_oled_quadro(compositor->fundo, compositor->quadro_fundo) : NULL;
+    for (uint8_t x = regiao.x0; x <= regiao.x1; x++)
+    {
+        for (uint8_t pagina = regiao.pagina0; pagina <= regiao.pagina1; pagina++)
+        {
+            uint16_t i = x * ssd->pages + pagina;
+            ssd->ram_buffer[1 + i] = fundo ? fundo[i] : 0;
+        }
+    }
+
+    uint8_t y0 = regiao.pagina0 * 8;
+    uint8_t y1 = regiao.pagina1 * 8 + 7;
+    for (int i = 0; i < compositor->num_camadas; i++)
+    {
+        const CamadaTela *camada = &compositor->camadas[i];
+        if (!camada->visivel)
+            continue;
+        // Só a interseção do retângulo da camada com a região
+        int cx0 = camada->area.x > regiao.x0 ? camada->area.x : regiao.x0;
+        int cx1 = camada->area.x + camada->area.largura - 1;
+        int cy0 = camada->area.y > y0 ? camada->area.y : y0;
+        int cy1 = camada->area.y + camada->area.altura - 1;
+        if (cx1 > regiao.x1)
+            cx1 = regiao.x1;
+        if (cy1 > y1)
+            cy1 = y1;
+        for (int x = cx0; x <= cx1; x++)
+            for (int y = cy0; y <= cy1; y++)
+                ssd1306_pixel(ssd, x, y, pixel_camada(camada, x - camada->area.x, y - camada->area.y));
+    }
+}
+
+static bool alguma_visivel(const Compositor *compositor)
+{
+    for (int i = 0; i < compositor->num_camadas; i++)
+        if (compositor->camadas[i].visivel)
+            return true;
+    return false;
+}
+
+static void marcar_letreiro(Compositor *compositor)
+{
+    marcar(compositor, (RegiaoTela){0, compositor->ssd->width - 1, compositor->letreiro_pagina0, compositor->letreiro_pagina1});
+}
+
+void compositor_letreiro(Compositor *compositor, bool ligado, uint8_t pagina0, uint8_t pagina1)
+{
+    bool mesma_faixa = compositor->letreiro_pagina0 == pagina0 && compositor->letreiro_pagina1 == pagina1;
+    if (compositor->letreiro == ligado && (!ligado || mesma_faixa))
+        return;
+    // Parar ou trocar de faixa: a faixa rolada volta ao lugar no próximo envio
+    if (compositor->letreiro_ativo)
+        marcar_letreiro(compositor);
+    compositor->letreiro = ligado;
+    if (ligado)
+    {
+        compositor->letreiro_pagina0 = pagina0;
+        compositor->letreiro_pagina1 = pagina1;
+    }
+}
+
+void compositor_piscar(Compositor *compositor, bool ligado, uint32_t agora_ms)
+{
+    if (ligado && !compositor->piscando)
+        compositor->inicio_piscar_ms = agora_ms;
+    compositor->piscando = ligado;
+}
+
+void compositor_balancar(Compositor *compositor, uint32_t agora_ms)
+{
+    compositor->balancando = true;
+    compositor->inicio_balanco_ms = agora_ms;
+}
+
+// Linha inicial de cada passo: desce 2 e 4 linhas, volta, sobe e volta
+static const uint8_t linhas_balanco[] = {2, 4, 2, 0, 62, 60, 62, 0};
+#define PASSOS_BALANCO (sizeof(linhas_balanco) / sizeof(linhas_balanco[0]))
+
+uint32_t compositor_animar(Compositor *compositor, uint32_t agora_ms)
+{
+    ssd1306_t *ssd = compositor->ssd;
+    uint32_t prazo = UINT32_MAX;
+
+    bool inverter = false;
+    if (compositor->piscando)
+    {
+        uint32_t decorrido = agora_ms - compositor->inicio_piscar_ms;
+        inverter = (decorrido / COMPOSITOR_PISCAR_MS) & 1;
+        prazo = COMPOSITOR_PISCAR_MS - decorrido % COMPOSITOR_PISCAR_MS;
+    }
+    if (inverter != compositor->invertido)
+    {
+        ssd1306_invert(ssd, inverter);
+        compositor->invertido = inverter;
+    }
+
+    uint8_t linha = 0;
+    if (compositor->balancando)
+    {
+        uint32_t decorrido = agora_ms - compositor->inicio_balanco_ms;
+        uint32_t passo = decorrido / COMPOSITOR_BALANCO_MS;
+        if (passo < PASSOS_BALANCO)
+        {
+            linha = linhas_balanco[passo];
+            uint32_t proximo = COMPOSITOR_BALANCO_MS - decorrido % COMPOSITOR_BALANCO_MS;
+            if (proximo < prazo)
+                prazo = proximo;
+        }
+        else
+            compositor->balancando = false;
+    }
+    if (linha != compositor->linha_inicial)
+    {
+        ssd1306_start_line(ssd, linha);
+        compositor->linha_inicial = linha;
+    }
+    return prazo;
+}
+
+bool compositor_enviar(Compositor *compositor)
+{
+    ssd1306_t *ssd = compositor->ssd;
+
+    // Com a rolagem ligada a RAM não aceita escrita: para e refaz a faixa junto
+    if (compositor->num_regioes > 0 && compositor->letreiro_ativo)
+    {
+        ssd1306_scroll_stop(ssd);
+        compositor->letreiro_ativo = false;
+        marcar_letreiro(compositor);
+    }
+
+    while (compositor->num_regioes > 0)
+    {
+        if (ssd1306_busy(ssd))
+            return true;
+        RegiaoTela regiao = compositor->regioes[0];
+        compositor->regioes[0] = compositor->regioes[--compositor->num_regioes];
+
+        // Tela inteira só com o fundo: as palavras da flash já estão prontas
+        bool inteira = bytes_regiao(regiao) == ssd->bufsize - 1;
+        const uint16_t *palavras = compositor->fundo ? asset_oled_palavras(compositor->fundo, compositor->quadro_fundo) : NULL;
+        if (inteira && palavras != NULL && ssd->bus != NULL && !alguma_visivel(compositor))
+        {
+            memcpy(ssd->ram_buffer + 1, asset_oled_quadro(compositor->fundo, compositor->quadro_fundo), ssd->bufsize - 1);
+            ssd1306_send_frame_dma(ssd, palavras);
+            continue;
+        }
+
+        compor(compositor, regiao);
+        ssd1306_send_region(ssd, regiao.x0, regiao.x1, regiao.pagina0, regiao.pagina1);
+    }
+
+    // O letreiro só liga depois que o último envio terminou
+    if (compositor->letreiro && !compositor->letreiro_ativo)
+    {
+        if (ssd1306_busy(ssd))
+            return true;
+        ssd1306_scroll_horizontal(ssd, true, compositor->letreiro_pagina0, compositor->letreiro_pagina1, SSD1306_SCROLL_5_FRAMES);
+        compositor->letreiro_ativo = true;
+    }
+    return false;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file compositor.h
+ * @brief Composição da tela do OLED em camadas, enviando só o que mudou
+ *
+ * A tela é um fundo (uma imagem de lib/assets.h) e camadas por cima dele:
+ * textos, sprites e barras, cada uma num retângulo fixo e opaca dentro
+ * dele. Mudar o conteúdo de uma camada, mostrá-la ou escondê-la marca o
+ * retângulo dela como sujo; trocar o fundo marca só o retângulo que cobre
+ * os bytes diferentes entre a imagem antiga e a nova.
+ *
+ * compositor_enviar() refaz no ram_buffer apenas as regiões sujas (fundo e,
+ * por cima, as camadas visíveis que as cruzam, na ordem em que foram
+ * adicionadas) e envia só as colunas e páginas delas com
+ * ssd1306_send_region(). Um contador de segundos custa algumas dezenas de
+ * bytes de I2C em vez dos 1025 da tela inteira.
+ *
+ * O ram_buffer continua sendo o espelho da RAM do display: o resto da tela
+ * não é tocado.
+ *
+ * Alguns movimentos saem do próprio painel, sem reenviar a RAM:
+ *  - letreiro: rolagem horizontal contínua de uma faixa de páginas. Como o
+ *    SSD1306 não aceita escrita na RAM com a rolagem ligada, um envio
+ *    para a rolagem, reenvia a faixa (que ficou deslocada) junto com as
+ *    regiões sujas e religa a rolagem no fim;
+ *  - piscar: inverte a tela a cada COMPOSITOR_PISCAR_MS (1 byte por troca);
+ *  - balançar: uma sacudida vertical curta pela linha inicial do display.
+ * compositor_animar() aplica os passos devidos de piscar e balançar.
+ */
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+#include "assets.h"
+
+/** @brief Camadas por compositor */
+#define COMPOSITOR_MAX_CAMADAS 6
+
+/** @brief Regiões sujas guardadas; além disso as mais próximas são unidas */
+#define COMPOSITOR_MAX_REGIOES 4
+
+/** @brief Caracteres de uma camada de texto */
+#define COMPOSITOR_MAX_TEXTO 15
+
+/** @brief Meio período do piscar (tela normal, depois invertida) */
+#define COMPOSITOR_PISCAR_MS 500
+
+/** @brief Duração de cada passo do balanço */
+#define COMPOSITOR_BALANCO_MS 40
+
+typedef enum
+{
+    CAMADA_TEXTO = 0,  /**< Fonte 8x8 sobre o retângulo apagado */
+    CAMADA_SPRITE = 1, /**< Bitmap coluna a coluna, como os de lib/assets.h */
+    CAMADA_BARRA = 2,  /**< Moldura com preenchimento proporcional da esquerda */
+} TipoCamada;
+
+/**
+ * @brief Retângulo em pixels
+ */
+typedef struct
+{
+    uint8_t x, y;
+    uint8_t largura, altura;
+} RetanguloTela;
+
+/**
+ * @brief Região suja, em colunas e páginas (limites inclusivos)
+ */
+typedef struct
+{
+    uint8_t x0, x1;
+    uint8_t pagina0, pagina1;
+} RegiaoTela;
+
+typedef struct
+{
+    TipoCamada tipo;
+    bool visivel;
+    RetanguloTela area;
+    char texto[COMPOSITOR_MAX_TEXTO + 1];
+    const uint8_t *sprite; /**< largura * altura / 8 bytes */
+    uint8_t preenchido;    /**< Colunas preenchidas dentro da moldura da barra */
+} CamadaTela;
+
+typedef struct
+{
+    ssd1306_t *ssd;
+    const AssetOled *fundo; /**< NULL até o primeiro compositor_fundo() */
+    uint8_t quadro_fundo;
+    CamadaTela camadas[COMPOSITOR_MAX_CAMADAS];
+    uint8_t num_camadas;
+    RegiaoTela regioes[COMPOSITOR_MAX_REGIOES];
+    uint8_t num_regioes;
+
+    bool letreiro;                /**< Rolagem pedida */
+    bool letreiro_ativo;          /**< Rolagem ligada no painel */
+    uint8_t letreiro_pagina0, letreiro_pagina1;
+    bool piscando;
+    bool invertido;               /**< Estado do painel */
+    uint32_t inicio_piscar_ms;
+    bool balancando;
+    uint8_t linha_inicial;        /**< Estado do painel */
+    uint32_t inicio_balanco_ms;
+} Compositor;
+
+/**
+ * @brief Prepara o compositor para um display já configurado
+ */
+void compositor_init(Compositor *compositor, ssd1306_t *ssd);
+
+/**
+ * @brief Acrescenta uma camada, inicialmente escondida e vazia
+ *
+ * Camadas acrescentadas depois ficam por cima. Sprites precisam de altura
+ * múltipla de 8.
+ *
+ * @return Índice da camada, ou -1 se não há espaço
+ */
+int compositor_adicionar(Compositor *compositor, TipoCamada tipo, uint8_t x, uint8_t y, uint8_t largura, uint8_t altura);
+
+/**
+ * @brief Troca o fundo por um quadro de uma imagem do tamanho da tela
+ */
+void compositor_fundo(Compositor *compositor, const AssetOled *fundo, uint8_t quadro);
+
+/**
+ * @brief Texto de uma camada de texto (cortado no retângulo)
+ */
+void compositor_texto(Compositor *compositor, int camada, const char *texto);
+
+/**
+ * @brief Bitmap de uma camada de sprite
+ */
+void compositor_sprite(Compositor *compositor, int camada, const uint8_t *bitmap);
+
+/**
+ * @brief Preenchimento de uma camada de barra: valor de 0 a maximo
+ */
+void compositor_barra(Compositor *compositor, int camada, uint32_t valor, uint32_t maximo);
+
+/**
+ * @brief Mostra ou esconde uma camada
+ */
+void compositor_mostrar(Compositor *compositor, int camada, bool visivel);
+
+/**
+ * @brief Marca a tela inteira para ser refeita (display reiniciado, por exemplo)
+ */
+void compositor_invalidar(Compositor *compositor);
+
+/**
+ * @brief O display foi reconfigurado (ssd1306_config()): estado do painel no padrão e tela inteira suja
+ */
+void compositor_reiniciado(Compositor *compositor);
+
+/**
+ * @brief Liga ou desliga o letreiro nas páginas pagina0..pagina1
+ *
+ * A faixa inteira (todas as colunas) rola para a esquerda, com volta. Liga
+ * no próximo compositor_enviar() sem nada pendente.
+ */
+void compositor_letreiro(Compositor *compositor, bool ligado, uint8_t pagina0, uint8_t pagina1);
+
+/**
+ * @brief Liga ou desliga o piscar da tela inteira
+ */
+void compositor_piscar(Compositor *compositor, bool ligado, uint32_t agora_ms);
+
+/**
+ * @brief Começa um balanço vertical da tela
+ */
+void compositor_balancar(Compositor *compositor, uint32_t agora_ms);
+
+/**
+ * @brief Aplica os passos devidos de piscar e balançar
+ *
+ * Chamar antes de compositor_enviar(), com o display livre.
+ *
+ * @return ms até o próximo passo, ou UINT32_MAX se nada está em andamento
+ */
+uint32_t compositor_animar(Compositor *compositor, uint32_t agora_ms);
+
+/**
+ * @brief Refaz e envia as regiões sujas
+ *
+ * Com o display num barramento (ssd1306_attach_bus()) enfileira uma região
+ * por chamada e volta sem esperar; sem ele envia todas, bloqueando. Se a
+ * tela inteira está suja e nenhuma camada está visível, o fundo vai direto
+ * da flash (ssd1306_send_frame_dma()). Liga o letreiro pedido quando não
+ * sobra nada.
+ *
+ * @return true se ainda há trabalho (chamar de novo quando a fila esvaziar)
+ */
+bool compositor_enviar(Compositor *compositor);
+
+#endif /* COMPOSITOR_H_ */
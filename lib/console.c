@@ -0,0 +1,122 @@
+/**
+ * @file console.c
+ * @brief Implementação do console serial
+ */
+
+#include "console.h"
+#include "comandos.h"
+#include "estado_controlador.h"
+#include "relogio.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CONSOLE_TAMANHO_LINHA 32
+
+static Executor *executor_console = NULL;
+static int job_console = -1;
+static uint8_t grupo_padrao = 0;
+
+// Linha em montagem entre duas execuções do job
+static char recebida[CONSOLE_TAMANHO_LINHA];
+static size_t tamanho = 0;
+
+/**
+ * @brief Aviso do stdio de que chegaram caracteres (contexto de interrupção)
+ */
+static void caracteres_disponiveis(void *parametro)
+{
+    (void)parametro;
+    BaseType_t acordar = pdFALSE;
+    executor_acordar_de_isr(executor_console, job_console, &acordar);
+    portYIELD_FROM_ISR(acordar);
+}
+
+/**
+ * @brief Converte uma linha em comando
+ *
+ * @return false se a linha não é um comando conhecido
+ */
+static bool interpretar(char *linha, Comando *comando)
+{
+    // Primeira palavra: nome do comando; o resto, o argumento opcional
+    char *argumento = strchr(linha, ' ');
+    if (argumento != NULL)
+        *argumento++ = '\0';
+
+    comando->origem = ORIGEM_CONSOLE;
+    comando->argumento = 0;
+    if (strcmp(linha, "modo") == 0)
+        comando->tipo = COMANDO_ALTERNAR_MODO;
+    else if (strcmp(linha, "normal") == 0)
+    {
+        comando->tipo = COMANDO_DEFINIR_MODO;
+        comando->argumento = MODO_NORMAL;
+    }
+    else if (strcmp(linha, "noturno") == 0)
+    {
+        comando->tipo = COMANDO_DEFINIR_MODO;
+        comando->argumento = MODO_NOTURNO;
+    }
+    else if (strcmp(linha, "pedestre") == 0)
+    {
+        comando->tipo = COMANDO_CHAMADA_PEDESTRE;
+        comando->argumento = (argumento != NULL && *argumento != '\0') ? (uint8_t)atoi(argumento) : grupo_padrao;
+    }
+    else if (strcmp(linha, "preempcao") == 0)
+        comando->tipo = COMANDO_PREEMPCAO;
+    else if (strcmp(linha, "status") == 0)
+        comando->tipo = COMANDO_STATUS;
+    else
+        return false;
+    return true;
+}
+
+static void executar_linha(char *linha)
+{
+    Comando comando;
+    uint64_t recebido = relogio_us();
+    if (!interpretar(linha, &comando))
+    {
+        printf("console: comando desconhecido '%s'\n", linha);
+        return;
+    }
+    comando.instante_us = recebido;
+    if (!comandos_enviar(&comando))
+        printf("console: fila cheia, '%s' descartado\n", linha);
+}
+
+/**
+ * @brief Job que monta as linhas recebidas e posta os comandos
+ */
+static uint32_t rodar_console(uint32_t agora_ms, void *contexto)
+{
+    (void)agora_ms;
+    (void)contexto;
+
+    int c;
+    while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT)
+    {
+        if (c == '\r' || c == '\n')
+        {
+            recebida[tamanho] = '\0';
+            if (tamanho > 0)
+                executar_linha(recebida);
+            tamanho = 0;
+        }
+        else if (tamanho < sizeof(recebida) - 1)
+            recebida[tamanho++] = (char)c;
+    }
+    return EXECUTOR_SEM_PRAZO;
+}
+
+int console_iniciar(Executor *executor, uint8_t prioridade, uint8_t grupo_pedestre)
+{
+    grupo_padrao = grupo_pedestre;
+    executor_console = executor;
+    job_console = executor_adicionar(executor, "console", rodar_console, NULL, prioridade, EXECUTOR_SEM_PRAZO);
+    if (job_console >= 0)
+        stdio_set_chars_available_callback(caracteres_disponiveis, NULL);
+    return job_console;
+}
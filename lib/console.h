@@ -0,0 +1,34 @@
+/**
+ * @file console.h
+ * @brief Console serial: linhas de texto viram comandos do controlador
+ *
+ * Comandos aceitos (um por linha, pela USB ou UART):
+ *
+ *     modo              alterna entre normal e noturno
+ *     normal | noturno  entra no modo indicado
+ *     pedestre [grupo]  chamada de pedestre (padrão: grupo de console_iniciar)
+ *     preempcao         preempção, liberada alguns segundos após o verde
+ *     status            imprime as latências dos comandos e os tempos dos jobs
+ *
+ * O console é um job de executor (lib/executor.h) sem varredura: só roda
+ * quando o stdio avisa que há caracteres (stdio_set_chars_available_callback).
+ */
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#include <stdint.h>
+#include "executor.h"
+
+/**
+ * @brief Adiciona o job do console e registra o aviso de caracteres do stdio
+ *
+ * Deve ser chamada depois de comandos_iniciar() e antes de executor_iniciar().
+ *
+ * @param prioridade Prioridade do job dentro do executor
+ * @param grupo_pedestre Grupo usado por "pedestre" sem argumento
+ * @return Identificador do job, ou -1 se o executor está cheio
+ */
+int console_iniciar(Executor *executor, uint8_t prioridade, uint8_t grupo_pedestre);
+
+#endif /* CONSOLE_H_ */
@@ -0,0 +1,91 @@
+/**
+ * @file detectores.c
+ * @brief Implementação dos detectores de veículos
+ */
+
+#include "detectores.h"
+#include "amostrador_adc.h"
+#include "entradas.h"
+#include <stdio.h>
+
+typedef struct
+{
+    ConfigDetector cfg;
+    bool ocupado;
+    uint32_t ultima_avaliacao;
+    ContagemDetector contagem;
+} Detector;
+
+static Detector detectores[DETECTORES_MAX];
+static uint8_t num_detectores = 0;
+
+int detectores_registrar(const ConfigDetector *cfg)
+{
+    if (num_detectores >= DETECTORES_MAX)
+        return -1;
+
+    detectores[num_detectores] = (Detector){.cfg = *cfg};
+    return num_detectores++;
+}
+
+/**
+ * @brief Lê a presença de um detector, com histerese no caso analógico
+ */
+static bool ler_presenca(const Detector *d)
+{
+    if (d->cfg.tipo == DETECTOR_DIGITAL)
+        return entradas_estado(d->cfg.fonte);
+
+    uint16_t media = amostrador_adc_media(d->cfg.fonte, DETECTOR_AMOSTRAS_MEDIA);
+    if (d->ocupado)
+        return media > d->cfg.limiar_liberado;
+    return media >= d->cfg.limiar_ocupado;
+}
+
+bool detectores_atualizar(uint32_t agora_ms)
+{
+    bool algum = false;
+
+    for (uint8_t i = 0; i < num_detectores; i++)
+    {
+        Detector *d = &detectores[i];
+
+        if (d->ocupado)
+            d->contagem.ocupado_ms += agora_ms - d->ultima_avaliacao;
+        d->ultima_avaliacao = agora_ms;
+
+        bool presenca = ler_presenca(d);
+        if (presenca && !d->ocupado)
+            d->contagem.acionamentos++;
+        d->ocupado = presenca;
+
+        algum |= presenca;
+    }
+    return algum;
+}
+
+bool detectores_ocupado(uint8_t indice)
+{
+    return (indice < num_detectores) ? detectores[indice].ocupado : false;
+}
+
+void detectores_fechar_ciclo(uint32_t ciclo, uint32_t duracao_ms)
+{
+    for (uint8_t i = 0; i < num_detectores; i++)
+    {
+        ContagemDetector *c = &detectores[i].contagem;
+        uint32_t ocupacao = duracao_ms ? (c->ocupado_ms * 100) / duracao_ms : 0;
+
+        printf("ciclo %lu: detector %u acionamentos=%u ocupado=%lu ms (%lu%%)\n",
+               (unsigned long)ciclo, i, c->acionamentos,
+               (unsigned long)c->ocupado_ms, (unsigned long)ocupacao);
+
+        c->acionamentos = 0;
+        c->ocupado_ms = 0;
+    }
+}
+
+uint8_t detectores_quantidade(void)
+{
+    return num_detectores;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file detectores.h
+ * @brief Detectores de veículos (laço analógico ou contato de presença)
+ *
+ * Detectores analógicos leem o anel do amostrador de ADC e aplicam
+ * histerese; detectores digitais usam o estado estável de uma entrada do
+ * subsistema de entradas. Cada detector acumula, por ciclo, o número de
+ * acionamentos (chegadas) e o tempo ocupado.
+ */
+
+#ifndef DETECTORES_H_
+#define DETECTORES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/** @brief Número máximo de detectores */
+#define DETECTORES_MAX 4
+
+/** @brief Amostras do ADC usadas na média de um detector analógico */
+#define DETECTOR_AMOSTRAS_MEDIA 8
+
+typedef enum
+{
+    DETECTOR_ANALOGICO = 0, // Laço indutivo / sensor analógico no ADC
+    DETECTOR_DIGITAL = 1,   // Contato de presença (entrada digital)
+} TipoDetector;
+
+/**
+ * @brief Configuração de um detector
+ */
+typedef struct
+{
+    TipoDetector tipo;
+    uint8_t fonte;            /**< Canal do ADC ou id de entrada (entradas_registrar) */
+    uint16_t limiar_ocupado;  /**< Analógico: média acima disto = ocupado */
+    uint16_t limiar_liberado; /**< Analógico: média abaixo disto = livre */
+} ConfigDetector;
+
+/**
+ * @brief Contagens de um detector no ciclo corrente
+ */
+typedef struct
+{
+    uint16_t acionamentos;  /**< Transições livre -> ocupado */
+    uint32_t ocupado_ms;    /**< Tempo total ocupado */
+} ContagemDetector;
+
+/**
+ * @brief Registra um detector
+ *
+ * @return Índice do detector, ou -1 se não há espaço
+ */
+int detectores_registrar(const ConfigDetector *cfg);
+
+/**
+ * @brief Avalia todos os detectores e acumula as contagens
+ *
+ * @param agora_ms Tempo atual em ms
+ * @return true se algum detector está ocupado
+ */
+bool detectores_atualizar(uint32_t agora_ms);
+
+/**
+ * @brief Indica se um detector está ocupado (última avaliação)
+ */
+bool detectores_ocupado(uint8_t indice);
+
+/**
+ * @brief Imprime as contagens do ciclo e zera os acumuladores
+ *
+ * @param ciclo Número do ciclo encerrado
+ * @param duracao_ms Duração do ciclo, para o percentual de ocupação
+ */
+void detectores_fechar_ciclo(uint32_t ciclo, uint32_t duracao_ms);
+
+/**
+ * @brief Número de detectores registrados
+ */
+uint8_t detectores_quantidade(void);
+
+#endif /* DETECTORES_H_ */
@@ -0,0 +1,151 @@
+/**
+ * @file energia.c
+ * @brief Implementação da gerência de energia
+ */
+
+#include "energia.h"
+#include "relogio.h"
+#include "amostrador_adc.h"
+#include "hardware/clocks.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+
+/* Port do RP2040: reprograma o SysTick a partir de clock_get_hz(clk_sys) */
+extern void vPortSetupTimerInterrupt(void);
+
+typedef struct
+{
+    uint32_t clock_khz;
+    uint32_t entradas;
+    uint64_t tempo_us;    // Trechos encerrados
+    uint64_t dormindo_us; // Soma dos sonos do idle
+    uint64_t soma_corrente_ma;
+    uint32_t amostras_corrente;
+} ContasModo;
+
+static const char *const nomes_modo[NUM_MODOS_ENERGIA] = {"normal", "noturno"};
+
+static AvisoClock avisos[ENERGIA_MAX_AVISOS];
+static uint8_t num_avisos = 0;
+static uint32_t clock_normal_khz = 0;
+
+static ContasModo contas[NUM_MODOS_ENERGIA];
+static ModoEnergia modo = ENERGIA_NORMAL;
+static bool contando = false; // A contagem começa na primeira energia_definir_modo()
+static uint64_t inicio_modo_us = 0;
+static uint64_t inicio_sono_us = 0;
+
+void energia_iniciar(void)
+{
+    // I2C e UART ficam com 48 MHz qualquer que seja o clk_sys
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+
+    clock_normal_khz = clock_get_hz(clk_sys) / 1000u;
+    modo = ENERGIA_NORMAL;
+    contas[modo].clock_khz = clock_normal_khz;
+    contas[modo].entradas = 1;
+}
+
+bool energia_avisar_clock(AvisoClock aviso)
+{
+    if (num_avisos >= ENERGIA_MAX_AVISOS)
+        return false;
+    avisos[num_avisos++] = aviso;
+    return true;
+}
+
+void energia_definir_modo(ModoEnergia novo)
+{
+    if (!contando)
+    {
+        inicio_modo_us = relogio_us();
+        contando = true;
+    }
+    if (novo == modo || novo >= NUM_MODOS_ENERGIA)
+        return;
+
+    uint32_t khz = (novo == ENERGIA_NOTURNO) ? ENERGIA_CLOCK_NOTURNO_KHZ : clock_normal_khz;
+
+    // Sem interrupções: nada roda com o SysTick e os divisores do clock antigo
+    taskENTER_CRITICAL();
+    uint64_t agora = relogio_us();
+    contas[modo].tempo_us += agora - inicio_modo_us;
+    inicio_modo_us = agora;
+    modo = novo;
+
+    if (khz != clock_get_hz(clk_sys) / 1000u && set_sys_clock_khz(khz, false))
+    {
+        vPortSetupTimerInterrupt();
+        for (uint8_t i = 0; i < num_avisos; i++)
+            avisos[i]();
+    }
+    contas[modo].clock_khz = clock_get_hz(clk_sys) / 1000u;
+    contas[modo].entradas++;
+    taskEXIT_CRITICAL();
+}
+
+ModoEnergia energia_modo(void)
+{
+    return modo;
+}
+
+void energia_amostrar_corrente(void)
+{
+#if ENERGIA_SENSOR_CORRENTE
+    uint32_t ma = (uint32_t)amostrador_adc_media(ENERGIA_CANAL_CORRENTE, 16) * ENERGIA_CORRENTE_FUNDO_MA / 4095u;
+    taskENTER_CRITICAL();
+    contas[modo].soma_corrente_ma += ma;
+    contas[modo].amostras_corrente++;
+    taskEXIT_CRITICAL();
+#endif
+}
+
+void energia_antes_de_dormir(void)
+{
+    // O timer de 64 bits roda no clk_ref e continua contando durante o WFI
+    inicio_sono_us = relogio_us();
+}
+
+void energia_depois_de_dormir(void)
+{
+    if (contando)
+        contas[modo].dormindo_us += relogio_us() - inicio_sono_us;
+}
+
+void energia_estatisticas(ModoEnergia m, EstatisticasEnergia *saida)
+{
+    taskENTER_CRITICAL();
+    ContasModo c = contas[m];
+    if (m == modo && contando)
+        c.tempo_us += relogio_us() - inicio_modo_us;
+    taskEXIT_CRITICAL();
+
+    saida->clock_khz = c.clock_khz;
+    saida->entradas = c.entradas;
+    saida->tempo_us = c.tempo_us;
+    saida->acordado_us = (c.tempo_us > c.dormindo_us) ? c.tempo_us - c.dormindo_us : 0;
+    saida->corrente_ma = c.amostras_corrente ? (int32_t)(c.soma_corrente_ma / c.amostras_corrente) : -1;
+}
+
+void energia_imprimir_estatisticas(void)
+{
+    for (int m = 0; m < NUM_MODOS_ENERGIA; m++)
+    {
+        EstatisticasEnergia e;
+        energia_estatisticas((ModoEnergia)m, &e);
+        if (e.entradas == 0)
+            continue;
+
+        // Acordado em décimos de porcento do tempo no modo
+        uint32_t permil = e.tempo_us ? (uint32_t)(e.acordado_us * 1000u / e.tempo_us) : 0;
+        printf("energia: %s clock_khz=%lu entradas=%lu tempo_ms=%llu acordado_ms=%llu acordado=%lu.%lu%%",
+               nomes_modo[m], (unsigned long)e.clock_khz, (unsigned long)e.entradas,
+               (unsigned long long)(e.tempo_us / 1000u), (unsigned long long)(e.acordado_us / 1000u),
+               (unsigned long)(permil / 10u), (unsigned long)(permil % 10u));
+        if (e.corrente_ma >= 0)
+            printf(" corrente_ma=%ld\n", (long)e.corrente_ma);
+        else
+            printf(" corrente_ma=n/d\n");
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file energia.h
+ * @brief Gerência de energia: clock por modo, sono no idle e tempo acordado
+ *
+ * No modo noturno o semáforo só pisca o amarelo e quase todo o tempo não há
+ * nada a fazer. Com o tickless idle do FreeRTOS (configUSE_TICKLESS_IDLE)
+ * o núcleo dorme em WFI entre os prazos das tasks, sem o tick de 1 ms, e
+ * acorda pelo SysTick reprogramado para o próximo prazo ou por uma
+ * interrupção. No modo noturno o clk_sys ainda desce para
+ * ENERGIA_CLOCK_NOTURNO_KHZ.
+ *
+ * energia_iniciar() põe o clk_peri no PLL USB (48 MHz), então I2C e UART
+ * não mudam com o clk_sys. O resto que depende dele é reajustado a cada
+ * troca: o SysTick aqui e o PIO da matriz, o timer de DMA do áudio e o PWM
+ * do LED RGB pelos avisos registrados com energia_avisar_clock().
+ *
+ * O tempo dormindo é medido pelos ganchos configPRE_SLEEP_PROCESSING e
+ * configPOST_SLEEP_PROCESSING (lib/FreeRTOSConfig.h); o tempo acordado é o
+ * restante do tempo passado em cada modo. Com um sensor de corrente num
+ * canal livre do ADC (ENERGIA_CANAL_CORRENTE), sai também a corrente média
+ * medida em cada modo.
+ */
+
+#ifndef ENERGIA_H_
+#define ENERGIA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief clk_sys no modo noturno (PLL do sistema: 1440 MHz / 6 / 5) */
+#define ENERGIA_CLOCK_NOTURNO_KHZ 48000
+
+/** @brief Canal do ADC com o sensor de corrente (shunt + amplificador), -1 sem sensor */
+#ifndef ENERGIA_CANAL_CORRENTE
+#define ENERGIA_CANAL_CORRENTE -1
+#endif
+
+/** @brief Corrente que leva o ADC ao fundo de escala (4095) */
+#define ENERGIA_CORRENTE_FUNDO_MA 500
+
+/** @brief Intervalo entre amostras de corrente */
+#define ENERGIA_AMOSTRA_CORRENTE_MS 1000
+
+/** @brief Há sensor de corrente */
+#define ENERGIA_SENSOR_CORRENTE (ENERGIA_CANAL_CORRENTE >= 0)
+
+/** @brief Funções avisadas depois de cada troca do clk_sys */
+#define ENERGIA_MAX_AVISOS 4
+
+typedef enum
+{
+    ENERGIA_NORMAL = 0, // clk_sys nominal
+    ENERGIA_NOTURNO,    // clk_sys reduzido
+    NUM_MODOS_ENERGIA
+} ModoEnergia;
+
+/**
+ * @brief Reajusta um periférico ao clk_sys atual (clock_get_hz(clk_sys))
+ *
+ * Chamada com as interrupções desligadas, logo depois da troca.
+ */
+typedef void (*AvisoClock)(void);
+
+/**
+ * @brief Medidas de um modo
+ */
+typedef struct
+{
+    uint32_t clock_khz;   /**< clk_sys no modo */
+    uint32_t entradas;    /**< Vezes que o modo foi assumido */
+    uint64_t tempo_us;    /**< Tempo total no modo */
+    uint64_t acordado_us; /**< Parte do tempo com o núcleo acordado */
+    int32_t corrente_ma;  /**< Corrente média medida, -1 sem sensor ou amostras */
+} EstatisticasEnergia;
+
+/**
+ * @brief Põe o clk_peri no PLL USB; o firmware começa no modo normal
+ *
+ * Deve ser chamada antes de stdio_init_all() e i2c_init(), que calculam os
+ * divisores de baud a partir do clk_peri. O tempo por modo é contado a
+ * partir da primeira energia_definir_modo().
+ */
+void energia_iniciar(void);
+
+/**
+ * @brief Registra um periférico para reajustar quando o clk_sys muda
+ *
+ * @return false se não há espaço
+ */
+bool energia_avisar_clock(AvisoClock aviso);
+
+/**
+ * @brief Assume um modo: troca o clk_sys e reajusta SysTick e avisos
+ *
+ * Chamar de uma task que não esteja no meio de uma transferência que
+ * dependa do clk_sys (ex.: entre dois quadros da matriz). Se o clock do
+ * modo não puder ser gerado, o modo é contado com o clock atual.
+ */
+void energia_definir_modo(ModoEnergia modo);
+
+/**
+ * @brief Modo atual
+ */
+ModoEnergia energia_modo(void);
+
+/**
+ * @brief Lê o sensor de corrente (sem sensor, não faz nada)
+ */
+void energia_amostrar_corrente(void);
+
+/**
+ * @brief Ganchos do tickless idle, chamados pelo kernel em volta do WFI
+ */
+void energia_antes_de_dormir(void);
+void energia_depois_de_dormir(void);
+
+/**
+ * @brief Copia as medidas de um modo, incluindo o trecho em andamento
+ */
+void energia_estatisticas(ModoEnergia modo, EstatisticasEnergia *saida);
+
+/**
+ * @brief Imprime uma linha por modo
+ */
+void energia_imprimir_estatisticas(void);
+
+#endif /* ENERGIA_H_ */
@@ -0,0 +1,142 @@
+/**
+ * @file entradas.c
+ * @brief Implementação do subsistema de entradas com debounce por alarme
+ */
+
+#include "entradas.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+
+#define BORDAS (GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE)
+
+/**
+ * @brief Estado interno de uma entrada
+ */
+typedef struct
+{
+    ConfigEntrada cfg;
+    volatile bool estado;    // Último estado estável
+    uint64_t tempo_borda_us; // Primeira borda da janela de debounce atual
+} Entrada;
+
+static Entrada entradas[ENTRADAS_MAX];
+static uint8_t num_entradas = 0;
+static uint32_t mascara_pinos = 0;
+static QueueHandle_t fila_eventos = NULL;
+static AvisoEntrada aviso_evento = NULL;
+
+/**
+ * @brief Lê o nível lógico (ativo/inativo) de uma entrada
+ */
+static inline bool ler_entrada(const Entrada *e)
+{
+    return gpio_get(e->cfg.pino) != e->cfg.ativo_baixo;
+}
+
+/**
+ * @brief Fim da janela de debounce (contexto de interrupção do timer)
+ *
+ * Confirma o nível do pino, posta o evento se houve mudança e reabilita a
+ * interrupção de borda. A borda pendente é limpa antes da leitura, assim
+ * qualquer mudança posterior à leitura gera uma nova interrupção.
+ */
+static int64_t fim_debounce(alarm_id_t id, void *dados)
+{
+    uint8_t indice = (uint8_t)(uintptr_t)dados;
+    Entrada *e = &entradas[indice];
+    BaseType_t acordar = pdFALSE;
+
+    gpio_acknowledge_irq(e->cfg.pino, BORDAS);
+    bool nivel = ler_entrada(e);
+
+    if (nivel != e->estado)
+    {
+        e->estado = nivel;
+        EventoEntrada evento = {
+            .id = indice,
+            .ativo = nivel,
+            .tempo_us = e->tempo_borda_us,
+        };
+        if (xQueueSendFromISR(fila_eventos, &evento, &acordar) == pdTRUE && aviso_evento != NULL)
+            aviso_evento(&acordar);
+    }
+
+    gpio_set_irq_enabled(e->cfg.pino, BORDAS, true);
+    portYIELD_FROM_ISR(acordar);
+    return 0; // Alarme de disparo único
+}
+
+/**
+ * @brief Handler de interrupção de GPIO compartilhado pelas entradas
+ *
+ * Registrado como handler "raw" apenas para os pinos das entradas, de modo
+ * que convive com o callback de GPIO do botão de reset.
+ */
+static void entradas_gpio_irq(void)
+{
+    for (uint8_t i = 0; i < num_entradas; i++)
+    {
+        Entrada *e = &entradas[i];
+        uint32_t eventos = gpio_get_irq_event_mask(e->cfg.pino) & BORDAS;
+        if (!eventos)
+            continue;
+
+        // Ignora os repiques até o fim da janela de debounce
+        gpio_acknowledge_irq(e->cfg.pino, eventos);
+        gpio_set_irq_enabled(e->cfg.pino, BORDAS, false);
+        e->tempo_borda_us = time_us_64();
+
+        uint16_t debounce_ms = e->cfg.debounce_ms ? e->cfg.debounce_ms : ENTRADA_DEBOUNCE_PADRAO_MS;
+        if (add_alarm_in_us((uint64_t)debounce_ms * 1000, fim_debounce, (void *)(uintptr_t)i, true) < 0)
+        {
+            // Sem alarme disponível: reabilita a borda para tentar de novo
+            gpio_set_irq_enabled(e->cfg.pino, BORDAS, true);
+        }
+    }
+}
+
+int entradas_registrar(const ConfigEntrada *cfg)
+{
+    if (num_entradas >= ENTRADAS_MAX)
+        return -1;
+
+    entradas[num_entradas].cfg = *cfg;
+    mascara_pinos |= 1u << cfg->pino;
+    return num_entradas++;
+}
+
+void entradas_iniciar(QueueHandle_t fila)
+{
+    fila_eventos = fila;
+
+    for (uint8_t i = 0; i < num_entradas; i++)
+    {
+        Entrada *e = &entradas[i];
+        gpio_init(e->cfg.pino);
+        gpio_set_dir(e->cfg.pino, GPIO_IN);
+        if (e->cfg.ativo_baixo)
+            gpio_pull_up(e->cfg.pino);
+        else
+            gpio_pull_down(e->cfg.pino);
+        e->estado = ler_entrada(e);
+    }
+
+    gpio_add_raw_irq_handler_masked(mascara_pinos, entradas_gpio_irq);
+
+    for (uint8_t i = 0; i < num_entradas; i++)
+    {
+        gpio_acknowledge_irq(entradas[i].cfg.pino, BORDAS);
+        gpio_set_irq_enabled(entradas[i].cfg.pino, BORDAS, true);
+    }
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+bool entradas_estado(uint8_t id)
+{
+    return (id < num_entradas) ? entradas[id].estado : false;
+}
+
+void entradas_definir_aviso(AvisoEntrada aviso)
+{
+    aviso_evento = aviso;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file entradas.h
+ * @brief Subsistema genérico de entradas digitais com debounce por hardware
+ *
+ * Cada entrada (botão de modo, botoeira de pedestre, contato de detector...)
+ * gera interrupção de GPIO nas duas bordas. A primeira borda desabilita a
+ * interrupção do pino e agenda um alarme do timer de hardware; quando o
+ * alarme vence, o nível é lido e, se mudou em relação ao último estado
+ * estável, um evento é postado na fila. Não há varredura periódica: a
+ * latência é limitada pelo tempo de debounce da entrada.
+ */
+
+#ifndef ENTRADAS_H_
+#define ENTRADAS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "FreeRTOS.h"
+#include "queue.h"
+
+/** @brief Número máximo de entradas registradas */
+#define ENTRADAS_MAX 8
+
+/** @brief Tempo de debounce padrão (ms) */
+#define ENTRADA_DEBOUNCE_PADRAO_MS 20
+
+/**
+ * @brief Configuração de uma entrada
+ */
+typedef struct
+{
+    uint pino;            /**< GPIO da entrada */
+    bool ativo_baixo;     /**< true se a entrada é ativa em nível baixo (pull-up) */
+    uint16_t debounce_ms; /**< Janela de estabilização (0 = padrão) */
+} ConfigEntrada;
+
+/**
+ * @brief Evento de entrada já estabilizado
+ */
+typedef struct
+{
+    uint8_t id;        /**< Identificador retornado por entradas_registrar() */
+    bool ativo;        /**< Novo estado lógico da entrada */
+    uint64_t tempo_us; /**< Instante da primeira borda (time_us_64) */
+} EventoEntrada;
+
+/**
+ * @brief Registra uma entrada
+ *
+ * Deve ser chamada antes de entradas_iniciar().
+ *
+ * @param cfg Configuração da entrada
+ * @return Identificador da entrada, ou -1 se não há espaço
+ */
+int entradas_registrar(const ConfigEntrada *cfg);
+
+/**
+ * @brief Aviso de evento postado (contexto de interrupção)
+ *
+ * @param acordar Como em xQueueSendFromISR: pdTRUE se uma task deve rodar na saída
+ */
+typedef void (*AvisoEntrada)(BaseType_t *acordar);
+
+/**
+ * @brief Configura os pinos registrados e habilita as interrupções
+ *
+ * @param fila Fila que recebe os eventos (itens do tipo EventoEntrada)
+ */
+void entradas_iniciar(QueueHandle_t fila);
+
+/**
+ * @brief Registra quem avisar a cada evento postado na fila
+ *
+ * Para consumidores que não ficam bloqueados na fila (por exemplo, um job
+ * do executor, ver lib/executor.h).
+ *
+ * @param aviso Chamado logo depois de o evento entrar na fila (NULL = nenhum)
+ */
+void entradas_definir_aviso(AvisoEntrada aviso);
+
+/**
+ * @brief Retorna o último estado estável de uma entrada
+ *
+ * @param id Identificador da entrada
+ */
+bool entradas_estado(uint8_t id);
+
+#endif /* ENTRADAS_H_ */
@@ -0,0 +1,34 @@
+/**
+ * @file estado_controlador.c
+ * @brief Implementação do instantâneo do estado do controlador
+ */
+
+#include "estado_controlador.h"
+
+static EstadoControlador copias[2];
+static uint32_t sequencia = 0; // Publicações feitas; a cópia válida é copias[sequencia & 1]
+
+void estado_controlador_publicar(const EstadoControlador *estado)
+{
+    // Único escritor: a leitura relaxada do próprio contador basta
+    uint32_t s = __atomic_load_n(&sequencia, __ATOMIC_RELAXED) + 1;
+
+    // A publicação anterior precisa ser visível antes de sobrescrever a cópia
+    // que os leitores dela podem estar lendo
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    copias[s & 1] = *estado;
+    copias[s & 1].versao = s;
+
+    __atomic_store_n(&sequencia, s, __ATOMIC_RELEASE);
+}
+
+void estado_controlador_ler(EstadoControlador *saida)
+{
+    uint32_t s;
+    do
+    {
+        s = __atomic_load_n(&sequencia, __ATOMIC_ACQUIRE);
+        *saida = copias[s & 1];
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    } while (__atomic_load_n(&sequencia, __ATOMIC_RELAXED) != s);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file estado_controlador.h
+ * @brief Instantâneo do estado do controlador compartilhado entre tasks
+ *
+ * Só a task do controlador escreve (estado_controlador_publicar); buzzer,
+ * display, matriz e a task de entradas leem uma cópia consistente com
+ * estado_controlador_ler(), sem mutex e sem bloquear o escritor.
+ *
+ * São duas cópias e um contador de sequência: o escritor preenche a cópia
+ * que não está publicada e só então incrementa o contador, cujo bit 0 diz
+ * qual cópia vale. O leitor copia a cópia publicada e repete se o contador
+ * mudou no meio. Como o escritor nunca mexe na cópia publicada, um leitor
+ * que interrompe o escritor lê a versão anterior inteira em vez de esperar,
+ * qualquer que seja a prioridade de cada um. As barreiras (DMB) mantêm a
+ * ordem entre os dois núcleos do RP2040.
+ */
+
+#ifndef ESTADO_CONTROLADOR_H_
+#define ESTADO_CONTROLADOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Enumeração para os modos de operação do semáforo
+ */
+typedef enum
+{
+    MODO_NORMAL = 0,  // Funcionamento padrão (verde-amarelo-vermelho)
+    MODO_NOTURNO = 1, // Funcionamento noturno (amarelo piscante)
+} ModoOperacao;
+
+/**
+ * Enumeração para os estados possíveis do semáforo
+ */
+typedef enum
+{
+    ESTADO_VERDE = 0,           // Luz verde acesa
+    ESTADO_AMARELO = 1,         // Luz amarela acesa
+    ESTADO_VERMELHO = 2,        // Luz vermelha acesa
+    ESTADO_AMARELO_NOTURNO = 3, // Luz amarela no modo noturno
+    ESTADO_DESLIGADO = 4,       // Todas as luzes desligadas
+} EstadoSemaforo;
+
+/**
+ * @brief Estado do controlador visto pelas demais tasks
+ */
+typedef struct
+{
+    ModoOperacao modo;
+    EstadoSemaforo estado;
+    uint32_t inicio_fase_ms; /**< relogio_ms() da última mudança de estado */
+    uint32_t restante_ms;    /**< Verde restante (máximo, no atuado); 0 fora do verde */
+    bool preempcao;          /**< Estágio de preempção em andamento */
+    uint32_t ciclos;         /**< Ciclos completos do plano */
+    uint32_t versao;         /**< Número da publicação (muda a cada escrita) */
+} EstadoControlador;
+
+/**
+ * @brief Publica um novo estado (apenas a task do controlador)
+ *
+ * O campo versao é preenchido aqui.
+ */
+void estado_controlador_publicar(const EstadoControlador *estado);
+
+/**
+ * @brief Copia o último estado publicado
+ *
+ * Pode ser chamada de qualquer task, em qualquer núcleo. Antes da primeira
+ * publicação devolve modo normal, estado verde e zeros.
+ */
+void estado_controlador_ler(EstadoControlador *saida);
+
+#endif /* ESTADO_CONTROLADOR_H_ */
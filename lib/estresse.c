@@ -0,0 +1,56 @@
+/**
+ * @file estresse.c
+ * @brief Implementação do modo de estresse
+ */
+
+#include "estresse.h"
+
+#if ESTRESSE_HABILITADO
+
+#include "fases.h"
+#include "prioridades.h"
+#include "relogio.h"
+#include "pico/stdlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+
+static uint32_t orcamento = 0;
+
+void estresse_carga(CargaEstresse carga)
+{
+    busy_wait_us_32(carga == CARGA_DISPLAY ? ESTRESSE_CARGA_DISPLAY_US : ESTRESSE_CARGA_MATRIZ_US);
+}
+
+/**
+ * @brief Task que imprime o atraso das trocas e o compara com o orçamento
+ */
+static void tarefa_estresse(void *parametro)
+{
+    (void)parametro;
+    TickType_t ultimo = xTaskGetTickCount();
+
+    while (true)
+    {
+        vTaskDelayUntil(&ultimo, pdMS_TO_TICKS(ESTRESSE_PERIODO_MS));
+
+        AtrasoTrocas atrasos;
+        fases_atraso_trocas(&atrasos);
+        uint32_t media = atrasos.trocas ? atrasos.soma_ms / atrasos.trocas : 0;
+        printf("@E %llu trocas=%lu atraso_max_ms=%lu atraso_medio_ms=%lu orcamento_ms=%lu %s\n",
+               (unsigned long long)relogio_us(), (unsigned long)atrasos.trocas,
+               (unsigned long)atrasos.atraso_max_ms, (unsigned long)media, (unsigned long)orcamento,
+               atrasos.atraso_max_ms <= orcamento ? "ok" : "ESTOURO");
+    }
+}
+
+void estresse_iniciar(uint32_t orcamento_ms)
+{
+    orcamento = orcamento_ms;
+    TaskHandle_t tarefa = NULL;
+    xTaskCreate(tarefa_estresse, "Estresse", configMINIMAL_STACK_SIZE, NULL, prioridades_de(PAPEL_TELEMETRIA),
+                &tarefa);
+    prioridades_registrar(PAPEL_TELEMETRIA, tarefa);
+}
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file estresse.h
+ * @brief Modo de estresse: carga artificial na renderização
+ *
+ * Cada quadro do display e da matriz ganha uma espera ocupada extra
+ * (ESTRESSE_CARGA_*_US), sem ceder o processador, como se o desenho fosse
+ * muito mais caro. Com as prioridades de lib/prioridades.h o controlador
+ * continua preemptando a renderização, então o atraso das trocas de foco
+ * (fases_atraso_trocas()) deve ficar dentro do orçamento.
+ *
+ * A cada ESTRESSE_PERIODO_MS sai uma linha:
+ *
+ *     @E <tempo_us> trocas=<n> atraso_max_ms=<n> atraso_medio_ms=<n> orcamento_ms=<n> <ok|ESTOURO>
+ *
+ * Na simulação com relógio virtual a espera ocupada vira bloqueio (o tempo
+ * não anda enquanto uma task gira); use o relógio real para carga de
+ * verdade.
+ *
+ * Só é compilado com ESTRESSE_HABILITADO=1 (opção SEMAFORO_ESTRESSE do
+ * CMake); sem ela as chamadas somem do binário.
+ */
+
+#ifndef ESTRESSE_H_
+#define ESTRESSE_H_
+
+#include <stdint.h>
+
+#ifndef ESTRESSE_HABILITADO
+#define ESTRESSE_HABILITADO 0
+#endif
+
+#define ESTRESSE_CARGA_DISPLAY_US 20000 // Por quadro do OLED (além dos ~25 ms de I2C)
+#define ESTRESSE_CARGA_MATRIZ_US 10000  // Por quadro da matriz (38 ms entre quadros)
+#define ESTRESSE_PERIODO_MS 5000        // Intervalo entre relatórios
+
+typedef enum
+{
+    CARGA_DISPLAY = 0,
+    CARGA_MATRIZ = 1,
+} CargaEstresse;
+
+#if ESTRESSE_HABILITADO
+
+/**
+ * @brief Cria a task que confere o atraso das trocas contra o orçamento
+ *
+ * @param orcamento_ms Maior atraso aceito entre o instante previsto de uma troca e a troca
+ */
+void estresse_iniciar(uint32_t orcamento_ms);
+
+/**
+ * @brief Ocupa o processador pela carga de um quadro
+ */
+void estresse_carga(CargaEstresse carga);
+
+#else
+
+static inline void estresse_iniciar(uint32_t orcamento_ms)
+{
+    (void)orcamento_ms;
+}
+
+static inline void estresse_carga(CargaEstresse carga)
+{
+    (void)carga;
+}
+
+#endif
+
+#endif /* ESTRESSE_H_ */
@@ -0,0 +1,261 @@
+/**
+ * @file executor.c
+ * @brief Implementação do executor cooperativo
+ */
+
+#include "executor.h"
+#include "relogio.h"
+#include "hardware/sync.h"
+#include <stdio.h>
+
+/**
+ * @brief a vence antes de b (comparação por diferença, ver lib/relogio.h)
+ */
+static inline bool antes(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+static inline uint32_t prazo_no_heap(const Executor *ex, uint8_t i)
+{
+    return ex->jobs[ex->heap[i]].prazo_ms;
+}
+
+static void trocar(Executor *ex, uint8_t i, uint8_t j)
+{
+    uint8_t t = ex->heap[i];
+    ex->heap[i] = ex->heap[j];
+    ex->heap[j] = t;
+    ex->jobs[ex->heap[i]].posicao = i;
+    ex->jobs[ex->heap[j]].posicao = j;
+}
+
+static void subir(Executor *ex, uint8_t i)
+{
+    while (i > 0)
+    {
+        uint8_t pai = (i - 1) / 2;
+        if (!antes(prazo_no_heap(ex, i), prazo_no_heap(ex, pai)))
+            break;
+        trocar(ex, i, pai);
+        i = pai;
+    }
+}
+
+static void descer(Executor *ex, uint8_t i)
+{
+    while (true)
+    {
+        uint8_t menor = i;
+        uint8_t esq = 2 * i + 1, dir = 2 * i + 2;
+        if (esq < ex->tamanho_heap && antes(prazo_no_heap(ex, esq), prazo_no_heap(ex, menor)))
+            menor = esq;
+        if (dir < ex->tamanho_heap && antes(prazo_no_heap(ex, dir), prazo_no_heap(ex, menor)))
+            menor = dir;
+        if (menor == i)
+            return;
+        trocar(ex, i, menor);
+        i = menor;
+    }
+}
+
+static void agendar(Executor *ex, uint8_t job, uint32_t prazo_ms)
+{
+    Job *j = &ex->jobs[job];
+    j->prazo_ms = prazo_ms;
+    j->agendado = true;
+    j->posicao = ex->tamanho_heap;
+    ex->heap[ex->tamanho_heap++] = job;
+    subir(ex, j->posicao);
+}
+
+static void desagendar(Executor *ex, uint8_t job)
+{
+    Job *j = &ex->jobs[job];
+    uint8_t i = j->posicao;
+    uint8_t ultimo = --ex->tamanho_heap;
+    j->agendado = false;
+    if (i == ultimo)
+        return;
+
+    ex->heap[i] = ex->heap[ultimo];
+    ex->jobs[ex->heap[i]].posicao = i;
+    subir(ex, i);
+    descer(ex, ex->jobs[ex->heap[i]].posicao);
+}
+
+/**
+ * @brief Adianta para agora os jobs acordados desde a última volta
+ */
+static void aplicar_acordados(Executor *ex, uint32_t agora)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    uint32_t acordados = ex->acordados;
+    ex->acordados = 0;
+    restore_interrupts(estado);
+
+    for (uint8_t i = 0; acordados != 0; i++, acordados >>= 1)
+    {
+        if (!(acordados & 1u))
+            continue;
+        if (ex->jobs[i].agendado)
+        {
+            // Já vencido continua na frente; senão é adiantado
+            if (!antes(ex->jobs[i].prazo_ms, agora))
+            {
+                desagendar(ex, i);
+                agendar(ex, i, agora);
+            }
+        }
+        else
+            agendar(ex, i, agora);
+    }
+}
+
+/**
+ * @brief Job vencido de maior prioridade (empate: prazo mais antigo)
+ *
+ * @return Índice do job, ou -1 se nenhum venceu
+ */
+static int escolher(const Executor *ex, uint32_t agora)
+{
+    int escolhido = -1;
+    for (uint8_t i = 0; i < ex->tamanho_heap; i++)
+    {
+        const Job *j = &ex->jobs[ex->heap[i]];
+        if (antes(agora, j->prazo_ms))
+            continue;
+        if (escolhido < 0 || j->prioridade > ex->jobs[escolhido].prioridade ||
+            (j->prioridade == ex->jobs[escolhido].prioridade && antes(j->prazo_ms, ex->jobs[escolhido].prazo_ms)))
+            escolhido = ex->heap[i];
+    }
+    return escolhido;
+}
+
+/**
+ * @brief Roda um job vencido e o reagenda conforme o retorno
+ */
+static void rodar(Executor *ex, uint8_t indice)
+{
+    Job *j = &ex->jobs[indice];
+    uint32_t prazo = j->prazo_ms;
+    desagendar(ex, indice);
+
+    uint64_t inicio_us = relogio_us();
+    uint32_t inicio_ms = (uint32_t)(inicio_us / 1000u);
+    uint32_t proximo = j->funcao(inicio_ms, j->contexto);
+    uint32_t duracao = (uint32_t)(relogio_us() - inicio_us);
+
+    // Prazos em ms vezes 1000 dão a volta junto com os 32 bits baixos do tempo em µs
+    uint32_t atraso = (uint32_t)inicio_us - prazo * 1000u;
+    EstatisticasJob *e = &j->estatisticas;
+    e->execucoes++;
+    e->duracao_ultima_us = duracao;
+    e->duracao_total_us += duracao;
+    if (duracao > e->duracao_max_us)
+        e->duracao_max_us = duracao;
+    if ((int32_t)atraso > 0 && atraso > e->atraso_max_us)
+        e->atraso_max_us = atraso;
+
+    if (proximo != EXECUTOR_SEM_PRAZO)
+        agendar(ex, indice, inicio_ms + proximo);
+}
+
+/**
+ * @brief Task do executor: roda os jobs vencidos e dorme até o próximo prazo
+ */
+static void tarefa(void *parametro)
+{
+    Executor *ex = parametro;
+
+    // Primeiras execuções contadas daqui (prazo_ms guarda o atraso até agora)
+    uint32_t inicio = relogio_ms();
+    for (uint8_t i = 0; i < ex->num_jobs; i++)
+    {
+        if (ex->jobs[i].agendado)
+        {
+            ex->jobs[i].agendado = false;
+            agendar(ex, i, inicio + ex->jobs[i].prazo_ms);
+        }
+    }
+
+    while (true)
+    {
+        // Um job por volta: os acordados concorrem com os vencidos pela prioridade
+        uint32_t agora = relogio_ms();
+        aplicar_acordados(ex, agora);
+        int escolhido = escolher(ex, agora);
+        if (escolhido >= 0)
+        {
+            rodar(ex, (uint8_t)escolhido);
+            continue;
+        }
+
+        // O heap dá o prazo mais próximo para dormir
+        TickType_t espera = portMAX_DELAY;
+        if (ex->tamanho_heap > 0)
+        {
+            int32_t falta = (int32_t)(prazo_no_heap(ex, 0) - relogio_ms());
+            if (falta <= 0)
+                continue;
+            espera = pdMS_TO_TICKS(falta);
+        }
+        ulTaskNotifyTake(pdTRUE, espera);
+    }
+}
+
+int executor_adicionar(Executor *executor, const char *nome, FuncaoJob funcao, void *contexto, uint8_t prioridade,
+                       uint32_t atraso_ms)
+{
+    if (executor->num_jobs >= EXECUTOR_MAX_JOBS)
+        return -1;
+
+    Job *j = &executor->jobs[executor->num_jobs];
+    j->nome = nome;
+    j->funcao = funcao;
+    j->contexto = contexto;
+    j->prioridade = prioridade;
+    j->prazo_ms = atraso_ms;
+    j->agendado = atraso_ms != EXECUTOR_SEM_PRAZO;
+    return executor->num_jobs++;
+}
+
+void executor_iniciar(Executor *executor, const char *nome, configSTACK_DEPTH_TYPE pilha, UBaseType_t prioridade)
+{
+    executor->nome = nome;
+    xTaskCreate(tarefa, nome, pilha, executor, prioridade, &executor->tarefa);
+}
+
+void executor_acordar(Executor *executor, int job)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    executor->acordados |= 1u << job;
+    restore_interrupts(estado);
+    if (executor->tarefa != NULL)
+        xTaskNotifyGive(executor->tarefa);
+}
+
+void executor_acordar_de_isr(Executor *executor, int job, BaseType_t *acordar)
+{
+    executor->acordados |= 1u << job;
+    if (executor->tarefa != NULL)
+        vTaskNotifyGiveFromISR(executor->tarefa, acordar);
+}
+
+void executor_estatisticas(const Executor *executor, int job, EstatisticasJob *saida)
+{
+    *saida = executor->jobs[job].estatisticas;
+}
+
+void executor_imprimir_estatisticas(const Executor *executor)
+{
+    for (uint8_t i = 0; i < executor->num_jobs; i++)
+    {
+        const Job *j = &executor->jobs[i];
+        const EstatisticasJob *e = &j->estatisticas;
+        printf("executor: %s/%s n=%lu ultima_us=%lu media_us=%lu max_us=%lu atraso_max_us=%lu\n", executor->nome,
+               j->nome, (unsigned long)e->execucoes, (unsigned long)e->duracao_ultima_us,
+               (unsigned long)(e->execucoes ? e->duracao_total_us / e->execucoes : 0),
+               (unsigned long)e->duracao_max_us, (unsigned long)e->atraso_max_us);
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file executor.h
+ * @brief Executor cooperativo de jobs com prazos
+ *
+ * Os periféricos (buzzer, matriz, display, entradas) não precisam cada um
+ * de uma task com pilha própria acordando a cada 10 ms para descobrir que
+ * nada mudou. Cada um vira um job: uma função curta que faz o trabalho
+ * devido e devolve em quantos ms quer rodar de novo. O executor mantém os
+ * prazos num heap mínimo e a sua task dorme até o prazo mais próximo; nada
+ * roda entre dois prazos.
+ *
+ * Jobs que só dependem de eventos devolvem EXECUTOR_SEM_PRAZO e ficam fora
+ * do heap até alguém chamar executor_acordar() (de uma task ou de uma
+ * interrupção), o que os põe para rodar na hora.
+ *
+ * Os jobs de um executor rodam um de cada vez, na task dele, então não
+ * podem bloquear: um job lento atrasa os outros do mesmo executor. Entre
+ * vários jobs vencidos roda primeiro o de maior prioridade (depois, o de
+ * prazo mais antigo); um job acordado entra nessa escolha antes do próximo.
+ * A duração e o atraso de cada execução são medidos (executor_estatisticas()).
+ */
+
+#ifndef EXECUTOR_H_
+#define EXECUTOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/** @brief Jobs por executor */
+#define EXECUTOR_MAX_JOBS 8
+
+/** @brief Retorno de um job que só roda de novo quando acordado */
+#define EXECUTOR_SEM_PRAZO UINT32_MAX
+
+/**
+ * @brief Função de um job
+ *
+ * @param agora_ms Instante de início da execução (relogio_ms)
+ * @param contexto Ponteiro passado a executor_adicionar()
+ * @return ms até a próxima execução, ou EXECUTOR_SEM_PRAZO
+ */
+typedef uint32_t (*FuncaoJob)(uint32_t agora_ms, void *contexto);
+
+/**
+ * @brief Medidas de um job
+ */
+typedef struct
+{
+    uint32_t execucoes;
+    uint32_t duracao_ultima_us;
+    uint32_t duracao_max_us;
+    uint64_t duracao_total_us; /**< Para a média: duracao_total_us / execucoes */
+    uint32_t atraso_max_us;    /**< Maior atraso do início em relação ao prazo */
+} EstatisticasJob;
+
+typedef struct
+{
+    const char *nome;
+    FuncaoJob funcao;
+    void *contexto;
+    uint8_t prioridade; /**< Maior roda antes quando vários estão vencidos */
+    uint32_t prazo_ms;  /**< Válido só se agendado */
+    bool agendado;      /**< Está no heap */
+    uint8_t posicao;    /**< Índice no heap, se agendado */
+    EstatisticasJob estatisticas;
+} Job;
+
+/**
+ * @brief Um executor: uma task e os seus jobs
+ *
+ * Alocado pelo chamador (normalmente static); os campos são internos.
+ */
+typedef struct
+{
+    const char *nome;
+    TaskHandle_t tarefa;
+    Job jobs[EXECUTOR_MAX_JOBS];
+    uint8_t num_jobs;
+    uint8_t heap[EXECUTOR_MAX_JOBS]; /**< Índices de jobs, ordenados pelo prazo */
+    uint8_t tamanho_heap;
+    volatile uint32_t acordados; /**< Um bit por job com executor_acordar() pendente */
+} Executor;
+
+/**
+ * @brief Adiciona um job
+ *
+ * Deve ser chamada antes de executor_iniciar().
+ *
+ * @param prioridade Ordem entre jobs vencidos ao mesmo tempo (maior primeiro)
+ * @param atraso_ms Primeira execução, contada do início da task
+ *                  (EXECUTOR_SEM_PRAZO = só quando acordado)
+ * @return Identificador do job, ou -1 se não há espaço
+ */
+int executor_adicionar(Executor *executor, const char *nome, FuncaoJob funcao, void *contexto, uint8_t prioridade,
+                       uint32_t atraso_ms);
+
+/**
+ * @brief Cria a task do executor
+ *
+ * @param pilha Pilha da task (palavras): a do job mais exigente
+ */
+void executor_iniciar(Executor *executor, const char *nome, configSTACK_DEPTH_TYPE pilha, UBaseType_t prioridade);
+
+/**
+ * @brief Põe um job para rodar assim que possível (tasks)
+ *
+ * Pode ser chamada antes de executor_iniciar(): o job roda na primeira volta.
+ */
+void executor_acordar(Executor *executor, int job);
+
+/**
+ * @brief Põe um job para rodar assim que possível (interrupções)
+ *
+ * @param acordar Recebe pdTRUE se a task do executor deve rodar na saída da interrupção
+ */
+void executor_acordar_de_isr(Executor *executor, int job, BaseType_t *acordar);
+
+/**
+ * @brief Copia as medidas de um job
+ */
+void executor_estatisticas(const Executor *executor, int job, EstatisticasJob *saida);
+
+/**
+ * @brief Imprime uma linha por job
+ */
+void executor_imprimir_estatisticas(const Executor *executor);
+
+#endif /* EXECUTOR_H_ */
@@ -0,0 +1,757 @@
+/**
+ * @file fases.c
+ * @brief Implementação do motor de fases com grupos, estágios e conflitos
+ */
+
+#include "fases.h"
+#include "detectores.h"
+#include "leds.h"
+#include "matrizRGB.h"
+#include "relogio.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include <stdio.h>
+
+#define INTENSIDADE_PIXEL_GRUPO 0.05f // Intensidade dos pixels de grupo na matriz
+#define NIVEL_PWM_ACESO 4095          // Foco aceso (wrap de 12 bits)
+
+static const PlanoSemaforico *plano = NULL;
+
+/* Estado dos grupos */
+static CorSinal cores[FASES_MAX_GRUPOS];
+static uint32_t fim_verde[FASES_MAX_GRUPOS]; // Instante em que o grupo saiu do verde
+static uint32_t liberacao[FASES_MAX_GRUPOS]; // Instante a partir do qual o grupo pode receber verde
+static uint32_t mascara_verde = 0;
+static uint32_t mascara_amarelo = 0;
+
+/* Dados pré-calculados do plano */
+static uint8_t detectores_estagio[FASES_MAX_ESTAGIOS + 1]; // + estágio de preempção
+static uint32_t entreverde_max[FASES_MAX_GRUPOS]; // Maior entreverde de entrada de cada grupo
+static bool usa_matriz = false;
+
+/* Estado do estágio */
+static uint8_t estagio = 0;
+static bool em_transicao = false;
+static uint32_t inicio_estagio = 0;
+static uint32_t inicio_ciclo = 0;
+static uint32_t ultima_deteccao = 0;
+static uint32_t ciclo = 0;
+static bool houve_mudanca = false;
+
+/* Preempção */
+static bool preempcao_ativa = false;
+static uint8_t estagio_interrompido = 0;
+static uint64_t resposta_preempcao_us = 0; // Primeira saída trocada pela preempção (0 = nenhuma)
+static uint64_t verde_preempcao_us = 0;    // Saídas do estágio de preempção em verde (0 = ainda não)
+
+/* Chamadas de pedestres (escritas por outras tasks) */
+static volatile uint32_t chamadas = 0;
+static volatile uint32_t instante_chamada[FASES_MAX_GRUPOS];
+static EstatisticasChamada estatisticas[FASES_MAX_GRUPOS];
+
+/* Atraso das trocas com instante previsto (só o controlador escreve) */
+static AtrasoTrocas atrasos;
+
+/* Modo intermitente (noturno) */
+static bool intermitente = false;
+static bool intermitente_aceso = false;
+
+static const char *const nomes_motivo[] = {"tempo fixo", "gap-out", "max-out", "chamada de pedestre"};
+
+/**
+ * @brief Compara instantes em ms considerando o estouro do contador
+ */
+static inline bool ja_passou(uint32_t agora_ms, uint32_t instante_ms)
+{
+    return (int32_t)(agora_ms - instante_ms) >= 0;
+}
+
+/**
+ * @brief Registra o atraso de uma troca em relação ao instante previsto
+ */
+static void registrar_atraso(uint32_t previsto_ms, uint32_t agora_ms)
+{
+    uint32_t atraso = ja_passou(agora_ms, previsto_ms) ? agora_ms - previsto_ms : 0;
+    atrasos.trocas++;
+    atrasos.soma_ms += atraso;
+    if (atraso > atrasos.atraso_max_ms)
+        atrasos.atraso_max_ms = atraso;
+}
+
+/**
+ * @brief Estágio de índice i; o índice num_estagios é o de preempção
+ */
+static inline const Estagio *estagio_de(uint8_t i)
+{
+    return (i < plano->num_estagios) ? &plano->estagios[i] : plano->preempcao;
+}
+
+/**
+ * @brief Cor de exibição de um grupo (LED RGB e matriz)
+ */
+static npColor_t cor_exibicao(const GrupoSinal *g, CorSinal cor)
+{
+    switch (cor)
+    {
+    case SINAL_VERDE:
+        return COLOR_GREEN;
+    case SINAL_AMARELO:
+        return (g->tipo == GRUPO_PEDESTRE) ? COLOR_RED : COLOR_YELLOW;
+    default:
+        return COLOR_RED;
+    }
+}
+
+/**
+ * @brief Acende os focos PWM de um grupo (índice 0 = vermelho, 1 = amarelo, 2 = verde)
+ *
+ * @param foco Foco a acender, ou -1 para apagar todos
+ */
+static void acender_focos_pwm(const SaidaGrupo *s, int foco)
+{
+    for (int i = 0; i < 3; i++)
+        pwm_set_gpio_level(s->pinos[i], (i == foco) ? NIVEL_PWM_ACESO : 0);
+}
+
+/**
+ * @brief Atualiza a saída física de um grupo conforme a cor atual
+ */
+static void aplicar_saida(uint8_t g)
+{
+    const GrupoSinal *grupo = &plano->grupos[g];
+
+    switch (grupo->saida.tipo)
+    {
+    case SAIDA_LED_RGB:
+        acender_led_rgb_cor(cor_exibicao(grupo, cores[g]));
+        break;
+    case SAIDA_PWM:
+        acender_focos_pwm(&grupo->saida, (cores[g] == SINAL_VERDE) ? 2 : (cores[g] == SINAL_AMARELO) ? 1 : 0);
+        break;
+    default:
+        // Pixels da matriz são desenhados pela task da matriz
+        break;
+    }
+}
+
+/**
+ * @brief Atende a chamada pendente de um grupo que acabou de receber verde
+ */
+static void atender_chamada(uint8_t g, uint32_t agora_ms)
+{
+    uint32_t estado_irq = save_and_disable_interrupts();
+    bool pendente = chamadas & GRUPO(g);
+    chamadas &= ~GRUPO(g);
+    restore_interrupts(estado_irq);
+
+    if (!pendente)
+        return;
+
+    uint32_t latencia = agora_ms - instante_chamada[g];
+    EstatisticasChamada *e = &estatisticas[g];
+    if (e->atendimentos == 0 || latencia < e->minimo_ms)
+        e->minimo_ms = latencia;
+    if (latencia > e->maximo_ms)
+        e->maximo_ms = latencia;
+    e->soma_ms += latencia;
+    e->atendimentos++;
+
+    printf("fases: chamada de %s atendida em %lu ms (min %lu, media %lu, max %lu)\n",
+           plano->grupos[g].nome, (unsigned long)latencia, (unsigned long)e->minimo_ms,
+           (unsigned long)(e->soma_ms / e->atendimentos), (unsigned long)e->maximo_ms);
+}
+
+/**
+ * @brief Troca a cor de um grupo, mantendo as máscaras e a saída em dia
+ */
+static void mudar_cor(uint8_t g, CorSinal cor, uint32_t agora_ms)
+{
+    if (cores[g] == SINAL_VERDE && cor != SINAL_VERDE)
+        fim_verde[g] = agora_ms;
+    if (cor == SINAL_VERDE)
+        atender_chamada(g, agora_ms);
+
+    cores[g] = cor;
+    mascara_verde = (cor == SINAL_VERDE) ? (mascara_verde | GRUPO(g)) : (mascara_verde & ~GRUPO(g));
+    mascara_amarelo = (cor == SINAL_AMARELO) ? (mascara_amarelo | GRUPO(g)) : (mascara_amarelo & ~GRUPO(g));
+
+    aplicar_saida(g);
+    houve_mudanca = true;
+    if (preempcao_ativa && resposta_preempcao_us == 0)
+        resposta_preempcao_us = relogio_us();
+}
+
+/**
+ * @brief Inicia a troca para o estágio de destino
+ *
+ * Os grupos que saem vão para amarelo; para cada grupo que entra calcula o
+ * instante de liberação a partir dos entreverdes dos grupos conflitantes.
+ */
+static void iniciar_transicao(uint8_t destino, uint32_t agora_ms)
+{
+    const uint32_t grupos_destino = estagio_de(destino)->grupos;
+    const uint32_t saindo = mascara_verde & ~grupos_destino;
+    const uint32_t entrando = grupos_destino & ~mascara_verde;
+
+    estagio = destino;
+    em_transicao = true;
+
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        if (saindo & GRUPO(g))
+            mudar_cor(g, plano->grupos[g].amarelo_ms ? SINAL_AMARELO : SINAL_VERMELHO, agora_ms);
+    }
+
+    for (uint8_t j = 0; j < plano->num_grupos; j++)
+    {
+        if (!(entrando & GRUPO(j)))
+            continue;
+
+        liberacao[j] = agora_ms;
+        for (uint8_t i = 0; i < plano->num_grupos; i++)
+        {
+            if (!(plano->conflitos[j] & GRUPO(i)))
+                continue;
+
+            // Só importam os entreverdes ainda não cumpridos (evita o estouro do contador)
+            uint32_t entreverde = plano->entreverdes[i * plano->num_grupos + j];
+            uint32_t instante = fim_verde[i] + entreverde;
+            if (agora_ms - fim_verde[i] < entreverde && !ja_passou(liberacao[j], instante))
+                liberacao[j] = instante;
+        }
+
+        // Grupo interrompido em amarelo (preempção): o verde vem depois do próprio amarelo
+        uint32_t fim_amarelo = fim_verde[j] + plano->grupos[j].amarelo_ms;
+        if ((mascara_amarelo & GRUPO(j)) && !ja_passou(liberacao[j], fim_amarelo))
+            liberacao[j] = fim_amarelo;
+    }
+}
+
+/**
+ * @brief Encerra amarelos vencidos e libera os verdes pendentes do estágio
+ */
+static void avancar_transicao(uint32_t agora_ms)
+{
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        if ((mascara_amarelo & GRUPO(g)) && agora_ms - fim_verde[g] >= plano->grupos[g].amarelo_ms)
+        {
+            registrar_atraso(fim_verde[g] + plano->grupos[g].amarelo_ms, agora_ms);
+            mudar_cor(g, SINAL_VERMELHO, agora_ms);
+        }
+    }
+
+    if (!em_transicao)
+        return;
+
+    uint32_t pendentes = estagio_de(estagio)->grupos & ~mascara_verde;
+    for (uint8_t j = 0; j < plano->num_grupos; j++)
+    {
+        if (!(pendentes & GRUPO(j)) || !ja_passou(agora_ms, liberacao[j]))
+            continue;
+
+        // Regra de segurança: nenhum conflitante pode estar em verde ou amarelo,
+        // e um grupo interrompido em amarelo termina o amarelo antes do verde
+        if (((mascara_verde | mascara_amarelo) & plano->conflitos[j]) || (mascara_amarelo & GRUPO(j)))
+            continue;
+
+        registrar_atraso(liberacao[j], agora_ms);
+        mudar_cor(j, SINAL_VERDE, agora_ms);
+        pendentes &= ~GRUPO(j);
+    }
+
+    if (pendentes == 0)
+    {
+        em_transicao = false;
+        inicio_estagio = agora_ms;
+        ultima_deteccao = agora_ms;
+
+        // Instante em que a última saída da preempção ficou verde; se nenhuma
+        // precisou mudar, a resposta é o próprio fim da troca
+        if (preempcao_ativa && verde_preempcao_us == 0)
+        {
+            verde_preempcao_us = relogio_us();
+            if (resposta_preempcao_us == 0)
+                resposta_preempcao_us = verde_preempcao_us;
+        }
+    }
+}
+
+/**
+ * @brief Próximo estágio do ciclo, depois do atual, que tem o grupo g em verde
+ *
+ * @return Índice do estágio, ou num_estagios se nenhum tem o grupo
+ */
+static uint8_t estagio_que_serve(uint8_t g)
+{
+    for (uint8_t i = 1; i <= plano->num_estagios; i++)
+    {
+        uint8_t k = (estagio + i) % plano->num_estagios;
+        if (plano->estagios[k].grupos & GRUPO(g))
+            return k;
+    }
+    return plano->num_estagios;
+}
+
+/**
+ * @brief ms do início de uma transição agora até a liberação do verde do grupo g
+ *
+ * A mesma conta de iniciar_transicao(): os conflitantes em verde saem
+ * agora, os que já saíram descontam o que passou dos seus entreverdes, e
+ * um grupo ainda em amarelo termina o próprio amarelo.
+ */
+static uint32_t entreverde_ate(uint8_t g, uint32_t agora_ms)
+{
+    uint32_t restante = 0;
+    for (uint8_t i = 0; i < plano->num_grupos; i++)
+    {
+        if (!(plano->conflitos[g] & GRUPO(i)))
+            continue;
+
+        uint32_t entreverde = plano->entreverdes[i * plano->num_grupos + g];
+        uint32_t desde = (mascara_verde & GRUPO(i)) ? 0 : agora_ms - fim_verde[i];
+        if (desde < entreverde && entreverde - desde > restante)
+            restante = entreverde - desde;
+    }
+
+    uint32_t desde_verde = agora_ms - fim_verde[g];
+    if ((mascara_amarelo & GRUPO(g)) && desde_verde < plano->grupos[g].amarelo_ms &&
+        plano->grupos[g].amarelo_ms - desde_verde > restante)
+        restante = plano->grupos[g].amarelo_ms - desde_verde;
+    return restante;
+}
+
+/**
+ * @brief Decide se o verde do estágio atual deve terminar agora, e para qual estágio
+ *
+ * Uma chamada de pedestre prestes a estourar a espera máxima leva direto
+ * ao primeiro estágio que serve o grupo, saltando os do meio: com mais de
+ * dois estágios, percorrê-los inteiros passaria da espera.
+ *
+ * @param agora_ms Tempo atual
+ * @param motivo Índice em nomes_motivo (saída)
+ * @param destino Estágio seguinte (saída; o próximo do ciclo, salvo chamada)
+ */
+static bool estagio_encerrado(uint32_t agora_ms, uint8_t *motivo, uint8_t *destino)
+{
+    const Estagio *e = estagio_de(estagio);
+    uint32_t decorrido = agora_ms - inicio_estagio;
+    *destino = (estagio + 1) % plano->num_estagios;
+
+    // Chamada de pedestre de outro estágio: encurta o verde após o mínimo
+    uint32_t pendentes = chamadas & ~e->grupos;
+    if (pendentes && decorrido >= e->verde_min_ms)
+    {
+        for (uint8_t g = 0; g < plano->num_grupos; g++)
+        {
+            uint32_t espera = plano->grupos[g].espera_max_ms;
+            if (!(pendentes & GRUPO(g)) || espera == 0)
+                continue;
+            uint8_t servidor = estagio_que_serve(g);
+            if (servidor >= plano->num_estagios)
+                continue;
+
+            // Desconta os entreverdes da troca direta para que o verde do pedestre caia dentro da espera
+            uint32_t entreverde = entreverde_ate(g, agora_ms);
+            uint32_t folga = (espera > entreverde) ? espera - entreverde : 0;
+            if (agora_ms - instante_chamada[g] >= folga)
+            {
+                *motivo = 3;
+                *destino = servidor;
+                return true;
+            }
+        }
+    }
+
+    if (e->controle == CONTROLE_FIXO)
+    {
+        *motivo = 0;
+        return decorrido >= e->verde_ms;
+    }
+
+    if (decorrido < e->verde_min_ms)
+        return false;
+
+    if (decorrido >= e->verde_max_ms)
+    {
+        *motivo = 2;
+        return true;
+    }
+
+    // Sem veículos dentro do intervalo de extensão: libera o verde
+    *motivo = 1;
+    return (agora_ms - ultima_deteccao) >= e->extensao_ms;
+}
+
+/**
+ * @brief Liga ou desliga os slices PWM dos focos dos grupos com SAIDA_PWM
+ *
+ * Com tudo apagado (intermitente desligado) não há por que manter os
+ * contadores rodando; os pinos ficam em nível baixo (ver led_pwm_pino()).
+ * O LED RGB para e volta sozinho, conforme a cor (leds.h).
+ */
+static void ligar_pwm_saidas(bool ligar)
+{
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        const SaidaGrupo *s = &plano->grupos[g].saida;
+        if (s->tipo == SAIDA_PWM)
+            for (int i = 0; i < 3; i++)
+                led_pwm_pino(s->pinos[i], ligar);
+    }
+}
+
+/**
+ * @brief Configura como PWM os focos dos grupos com SAIDA_PWM
+ */
+static void configurar_saidas(void)
+{
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_wrap(&config, NIVEL_PWM_ACESO);
+
+    usa_matriz = false;
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        const SaidaGrupo *s = &plano->grupos[g].saida;
+        if (s->tipo == SAIDA_PIXEL_MATRIZ)
+            usa_matriz = true;
+        if (s->tipo != SAIDA_PWM)
+            continue;
+
+        for (int i = 0; i < 3; i++)
+        {
+            gpio_set_function(s->pinos[i], GPIO_FUNC_PWM);
+            pwm_init(pwm_gpio_to_slice_num(s->pinos[i]), &config, true);
+        }
+    }
+}
+
+/**
+ * @brief Confere a consistência do plano e pré-calcula as máscaras por estágio
+ */
+static bool validar_plano(const PlanoSemaforico *p)
+{
+    if (p->num_grupos == 0 || p->num_grupos > FASES_MAX_GRUPOS ||
+        p->num_estagios == 0 || p->num_estagios > FASES_MAX_ESTAGIOS)
+    {
+        printf("fases: plano com dimensoes invalidas\n");
+        return false;
+    }
+
+    const uint32_t todos = GRUPO(p->num_grupos) - 1;
+
+    for (uint8_t j = 0; j < p->num_grupos; j++)
+        entreverde_max[j] = 0;
+
+    for (uint8_t i = 0; i < p->num_grupos; i++)
+    {
+        if ((p->conflitos[i] & GRUPO(i)) || (p->conflitos[i] & ~todos))
+        {
+            printf("fases: conflitos do grupo %s invalidos\n", p->grupos[i].nome);
+            return false;
+        }
+
+        for (uint8_t j = 0; j < p->num_grupos; j++)
+        {
+            if (!(p->conflitos[i] & GRUPO(j)))
+                continue;
+
+            if (!(p->conflitos[j] & GRUPO(i)))
+            {
+                printf("fases: matriz de conflitos assimetrica (%s, %s)\n", p->grupos[i].nome, p->grupos[j].nome);
+                return false;
+            }
+            uint16_t entreverde = p->entreverdes[i * p->num_grupos + j];
+            if (entreverde < p->grupos[i].amarelo_ms)
+            {
+                printf("fases: entreverde %s -> %s menor que o amarelo\n", p->grupos[i].nome, p->grupos[j].nome);
+                return false;
+            }
+            if (entreverde > entreverde_max[j])
+                entreverde_max[j] = entreverde;
+        }
+    }
+
+    // O estágio de preempção é validado junto, com índice num_estagios
+    uint8_t total = p->num_estagios + (p->preempcao ? 1 : 0);
+    for (uint8_t k = 0; k < total; k++)
+    {
+        uint32_t grupos = (k < p->num_estagios) ? p->estagios[k].grupos : p->preempcao->grupos;
+        uint32_t conflitos = 0;
+        uint8_t detectores = 0;
+
+        for (uint8_t g = 0; g < p->num_grupos; g++)
+        {
+            if (grupos & GRUPO(g))
+            {
+                conflitos |= p->conflitos[g];
+                detectores |= p->grupos[g].detectores;
+            }
+        }
+
+        // Verde simultâneo de grupos conflitantes: uma única operação de máscara
+        if ((grupos & conflitos) || (grupos & ~todos))
+        {
+            printf("fases: estagio %u contem grupos conflitantes\n", k);
+            return false;
+        }
+
+        detectores_estagio[k] = detectores;
+    }
+
+    return true;
+}
+
+bool fases_carregar_plano(const PlanoSemaforico *p, uint32_t agora_ms)
+{
+    if (!validar_plano(p))
+        return false;
+
+    plano = p;
+    intermitente = false;
+    preempcao_ativa = false;
+    chamadas = 0;
+    configurar_saidas();
+
+    // Parte do vermelho geral, com todos os entreverdes já cumpridos
+    mascara_verde = 0;
+    mascara_amarelo = 0;
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        cores[g] = SINAL_VERMELHO;
+        fim_verde[g] = agora_ms - UINT16_MAX;
+        aplicar_saida(g);
+    }
+
+    ciclo = 0;
+    inicio_ciclo = agora_ms;
+    iniciar_transicao(0, agora_ms);
+    avancar_transicao(agora_ms);
+    return true;
+}
+
+bool fases_atualizar(uint32_t agora_ms)
+{
+    if (plano == NULL || intermitente)
+        return false;
+
+    houve_mudanca = false;
+    detectores_atualizar(agora_ms);
+
+    if (!em_transicao)
+    {
+        // Qualquer detector dos grupos em verde estende o estágio
+        for (uint8_t d = 0; d < detectores_quantidade(); d++)
+        {
+            if ((detectores_estagio[estagio] & (1u << d)) && detectores_ocupado(d))
+                ultima_deteccao = agora_ms;
+        }
+
+        // Estágio de preempção: mantido até fases_encerrar_preempcao()
+        uint8_t motivo = 0;
+        uint8_t proximo = 0;
+        if (!preempcao_ativa && estagio_encerrado(agora_ms, &motivo, &proximo))
+        {
+            printf("fases: estagio %u encerrado por %s apos %lu ms\n",
+                   estagio, nomes_motivo[motivo], (unsigned long)(agora_ms - inicio_estagio));
+            if (proximo != (estagio + 1) % plano->num_estagios)
+                printf("fases: salto para o estagio %u\n", proximo);
+
+            // Passar pelo estágio 0 (inclusive num salto) fecha o ciclo
+            if (proximo <= estagio)
+            {
+                // Fim do ciclo: registra as contagens dos detectores
+                detectores_fechar_ciclo(ciclo, agora_ms - inicio_ciclo);
+                ciclo++;
+                inicio_ciclo = agora_ms;
+            }
+            iniciar_transicao(proximo, agora_ms);
+        }
+    }
+
+    avancar_transicao(agora_ms);
+    return houve_mudanca;
+}
+
+CorSinal fases_cor_grupo(uint8_t grupo)
+{
+    return (plano && grupo < plano->num_grupos) ? cores[grupo] : SINAL_VERMELHO;
+}
+
+uint8_t fases_estagio_atual(void)
+{
+    return estagio;
+}
+
+void fases_atraso_trocas(AtrasoTrocas *saida)
+{
+    *saida = atrasos;
+}
+
+uint32_t fases_ciclo(void)
+{
+    return ciclo;
+}
+
+uint32_t fases_verde_restante_ms(uint32_t agora_ms)
+{
+    if (plano == NULL || em_transicao || intermitente)
+        return 0;
+
+    const Estagio *e = estagio_de(estagio);
+    uint32_t duracao = (e->controle == CONTROLE_FIXO) ? e->verde_ms : e->verde_max_ms;
+    uint32_t decorrido = agora_ms - inicio_estagio;
+    return (decorrido < duracao) ? duracao - decorrido : 0;
+}
+
+bool fases_chamada_pedestre(uint8_t grupo, uint32_t instante_ms)
+{
+    if (plano == NULL || grupo >= plano->num_grupos || plano->grupos[grupo].tipo != GRUPO_PEDESTRE)
+        return false;
+
+    // Pedestre já em verde: nada a registrar
+    if (cores[grupo] == SINAL_VERDE && !intermitente)
+        return false;
+
+    uint32_t estado_irq = save_and_disable_interrupts();
+    if (!(chamadas & GRUPO(grupo)))
+    {
+        instante_chamada[grupo] = instante_ms;
+        chamadas |= GRUPO(grupo);
+    }
+    restore_interrupts(estado_irq);
+    return true;
+}
+
+bool fases_chamada_pendente(uint8_t grupo)
+{
+    return (chamadas & GRUPO(grupo)) != 0;
+}
+
+bool fases_estatisticas_chamada(uint8_t grupo, EstatisticasChamada *saida)
+{
+    if (plano == NULL || grupo >= plano->num_grupos)
+        return false;
+
+    *saida = estatisticas[grupo];
+    return true;
+}
+
+bool fases_preemptar(uint32_t agora_ms)
+{
+    if (plano == NULL || plano->preempcao == NULL || intermitente)
+        return false;
+    if (preempcao_ativa)
+        return true;
+
+    houve_mudanca = false;
+    preempcao_ativa = true;
+    estagio_interrompido = estagio;
+    resposta_preempcao_us = 0;
+    verde_preempcao_us = 0;
+
+    // Ignora o verde mínimo: a troca começa agora, com amarelos e entreverdes
+    printf("fases: preempcao no estagio %u\n", estagio);
+    iniciar_transicao(plano->num_estagios, agora_ms);
+    avancar_transicao(agora_ms);
+    return true;
+}
+
+void fases_encerrar_preempcao(uint32_t agora_ms)
+{
+    if (plano == NULL || !preempcao_ativa)
+        return;
+
+    preempcao_ativa = false;
+    printf("fases: fim da preempcao, retomando o estagio %u\n", estagio_interrompido);
+    iniciar_transicao(estagio_interrompido, agora_ms);
+    avancar_transicao(agora_ms);
+}
+
+bool fases_instantes_preempcao(uint64_t *resposta_us, uint64_t *verde_us)
+{
+    if (!preempcao_ativa)
+        return false;
+
+    *resposta_us = resposta_preempcao_us;
+    *verde_us = verde_preempcao_us;
+    return true;
+}
+
+uint32_t fases_limite_preempcao_ms(void)
+{
+    if (plano == NULL || plano->preempcao == NULL)
+        return 0;
+
+    uint32_t limite = 0;
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        if (!(plano->preempcao->grupos & GRUPO(g)))
+            continue;
+        if (entreverde_max[g] > limite)
+            limite = entreverde_max[g];
+        if (plano->grupos[g].amarelo_ms > limite)
+            limite = plano->grupos[g].amarelo_ms;
+    }
+    return limite;
+}
+
+bool fases_usa_matriz(void)
+{
+    return usa_matriz;
+}
+
+void fases_desenhar_matriz(void)
+{
+    if (plano == NULL)
+        return;
+
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        const GrupoSinal *grupo = &plano->grupos[g];
+        if (grupo->saida.tipo != SAIDA_PIXEL_MATRIZ)
+            continue;
+
+        npColor_t cor = cor_exibicao(grupo, cores[g]);
+        if (chamadas & GRUPO(g))
+            cor = COLOR_WHITE; // Indicador "aguarde" da botoeira
+        if (intermitente)
+            cor = (grupo->tipo == GRUPO_VEICULAR && intermitente_aceso) ? COLOR_YELLOW : COLOR_BLACK;
+
+        npSetLEDIntensity(grupo->saida.x, grupo->saida.y, cor, INTENSIDADE_PIXEL_GRUPO);
+    }
+    npWrite();
+}
+
+void fases_intermitente(bool aceso)
+{
+    if (plano == NULL)
+        return;
+
+    intermitente = true;
+    intermitente_aceso = aceso;
+    if (aceso)
+        ligar_pwm_saidas(true);
+
+    for (uint8_t g = 0; g < plano->num_grupos; g++)
+    {
+        const GrupoSinal *grupo = &plano->grupos[g];
+        bool amarelo = aceso && grupo->tipo == GRUPO_VEICULAR;
+
+        switch (grupo->saida.tipo)
+        {
+        case SAIDA_LED_RGB:
+            led_fade_to(amarelo ? COLOR_YELLOW : COLOR_BLACK, FASES_FADE_PISCA_MS);
+            break;
+        case SAIDA_PWM:
+            acender_focos_pwm(&grupo->saida, amarelo ? 1 : -1);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Apagado: todas as saídas em zero, os slices param até o próximo aceso
+    if (!aceso)
+        ligar_pwm_saidas(false);
+}
@@ -0,0 +1,290 @@
+/**
+ * @file fases.h
+ * @brief Motor de fases com grupos semafóricos, estágios e matriz de conflitos
+ *
+ * Um plano semafórico descreve N grupos de sinais (aproximações veiculares e
+ * travessias de pedestres), a matriz de conflitos entre eles, os tempos de
+ * entreverdes e a sequência de estágios (conjuntos de grupos em verde).
+ *
+ * Na troca de estágio, os grupos que saem passam por amarelo (ou vermelho
+ * intermitente, no caso de pedestres) e os que entram só recebem verde
+ * depois de cumpridos os entreverdes de todos os grupos conflitantes. Antes
+ * de qualquer verde o motor confere, com uma operação de máscara, que
+ * nenhum grupo conflitante está em verde ou amarelo.
+ *
+ * Cada estágio pode ter verde fixo ou atuado: no atuado o verde dura no
+ * mínimo verde_min_ms, é estendido enquanto os detectores dos grupos do
+ * estágio registram veículos com intervalo menor que extensao_ms e termina
+ * por "gap-out" (intervalo sem veículos) ou "max-out" (verde_max_ms).
+ *
+ * Grupos de pedestres podem receber chamadas (botoeira). Uma chamada fica
+ * registrada até o verde do grupo; se o grupo tem espera_max_ms, o estágio
+ * em curso é encerrado, depois do seu verde mínimo, a tempo de o verde do
+ * pedestre começar dentro da espera máxima: a troca vai direto ao próximo
+ * estágio que serve o grupo, saltando os do meio, e o prazo desconta os
+ * entreverdes dessa troca. A espera fica garantida se espera_max_ms cobre
+ * o verde mínimo de qualquer estágio mais esses entreverdes.
+ *
+ * A preempção (veículo de emergência) leva o controlador ao estágio de
+ * preempção do plano pelo mesmo caminho de uma troca normal: amarelo dos
+ * grupos que saem, entreverdes e conferência de conflitos. O verde mínimo
+ * do estágio em curso não é respeitado. O estágio de preempção fica fora do
+ * ciclo e é mantido até fases_encerrar_preempcao().
+ */
+
+#ifndef FASES_H_
+#define FASES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Número máximo de grupos semafóricos (bits da máscara) */
+#define FASES_MAX_GRUPOS 16
+
+/** @brief Número máximo de estágios em um plano */
+#define FASES_MAX_ESTAGIOS 8
+
+/** @brief Duração do fade do LED RGB em cada borda do intermitente */
+#define FASES_FADE_PISCA_MS 150
+
+/** @brief Máscara com o bit do grupo g */
+#define GRUPO(g) (1u << (g))
+
+typedef enum
+{
+    SINAL_VERMELHO = 0,
+    SINAL_AMARELO = 1, // Amarelo (veicular) ou vermelho intermitente (pedestre)
+    SINAL_VERDE = 2,
+} CorSinal;
+
+typedef enum
+{
+    GRUPO_VEICULAR = 0,
+    GRUPO_PEDESTRE = 1,
+} TipoGrupo;
+
+typedef enum
+{
+    CONTROLE_FIXO = 0,  // Verde de duração fixa (verde_ms)
+    CONTROLE_ATUADO = 1 // Verde estendido pelos detectores
+} TipoControle;
+
+typedef enum
+{
+    SAIDA_NENHUMA = 0,      // Grupo sem foco físico
+    SAIDA_LED_RGB = 1,      // LED RGB da placa (leds.h)
+    SAIDA_PWM = 2,          // Três focos em pinos PWM (vermelho, amarelo, verde)
+    SAIDA_PIXEL_MATRIZ = 3, // Um pixel da matriz 5x5
+} TipoSaida;
+
+/**
+ * @brief Onde o estado de um grupo é mostrado
+ */
+typedef struct
+{
+    TipoSaida tipo;
+    uint8_t pinos[3]; /**< SAIDA_PWM: pinos dos focos vermelho, amarelo e verde */
+    uint8_t x, y;     /**< SAIDA_PIXEL_MATRIZ: coordenadas do pixel */
+} SaidaGrupo;
+
+/**
+ * @brief Grupo semafórico
+ */
+typedef struct
+{
+    const char *nome;
+    TipoGrupo tipo;
+    uint32_t amarelo_ms; /**< Amarelo (veicular) ou vermelho intermitente (pedestre) */
+    uint8_t detectores;  /**< Máscara de detectores que estendem o verde do grupo */
+    uint32_t espera_max_ms; /**< Pedestre: espera máxima após a chamada (0 = sem política) */
+    SaidaGrupo saida;
+} GrupoSinal;
+
+/**
+ * @brief Estágio: conjunto de grupos em verde simultâneo
+ */
+typedef struct
+{
+    uint32_t grupos; /**< Máscara de grupos em verde */
+    TipoControle controle;
+    uint32_t verde_ms;     /**< Verde no controle fixo */
+    uint32_t verde_min_ms; /**< Verde mínimo (atuado e encurtamento por chamada) */
+    uint32_t verde_max_ms; /**< Verde máximo no controle atuado */
+    uint32_t extensao_ms;  /**< Intervalo sem detecção que encerra o verde */
+} Estagio;
+
+/**
+ * @brief Plano semafórico completo
+ */
+typedef struct
+{
+    const GrupoSinal *grupos;
+    uint8_t num_grupos;
+    const uint32_t *conflitos;   /**< conflitos[i]: máscara dos grupos conflitantes com i */
+    const uint16_t *entreverdes; /**< [i * num_grupos + j]: ms do fim do verde de i ao verde de j */
+    const Estagio *estagios;
+    uint8_t num_estagios;
+    const Estagio *preempcao; /**< Estágio de preempção (fora do ciclo), ou NULL */
+} PlanoSemaforico;
+
+/**
+ * @brief Estatísticas de latência chamada -> verde de um grupo de pedestres
+ */
+typedef struct
+{
+    uint32_t atendimentos; /**< Chamadas atendidas */
+    uint32_t minimo_ms;
+    uint32_t maximo_ms;
+    uint32_t soma_ms;      /**< Para a média: soma_ms / atendimentos */
+} EstatisticasChamada;
+
+/**
+ * @brief Atrasos das trocas de foco com instante previsto
+ *
+ * Fim de amarelo e liberação de verde têm instante conhecido; o atraso vai
+ * dele até a fases_atualizar() que aplicou a troca. Com o controlador em
+ * dia, fica abaixo do período de chamada.
+ */
+typedef struct
+{
+    uint32_t trocas;
+    uint32_t atraso_max_ms;
+    uint32_t soma_ms; /**< Para a média: soma_ms / trocas */
+} AtrasoTrocas;
+
+/**
+ * @brief Valida o plano e inicia a transição para o primeiro estágio
+ *
+ * Verifica a simetria da matriz de conflitos, que nenhum estágio tem grupos
+ * conflitantes e que cada entreverde cobre o amarelo do grupo que sai.
+ *
+ * @param plano Plano semafórico (deve permanecer válido)
+ * @param agora_ms Tempo atual em ms
+ * @return false se o plano é inválido (nada é alterado)
+ */
+bool fases_carregar_plano(const PlanoSemaforico *plano, uint32_t agora_ms);
+
+/**
+ * @brief Avalia detectores, tempos de estágio e entreverdes
+ *
+ * @param agora_ms Tempo atual em ms
+ * @return true se algum grupo mudou de cor nesta chamada
+ */
+bool fases_atualizar(uint32_t agora_ms);
+
+/**
+ * @brief Cor atual de um grupo
+ */
+CorSinal fases_cor_grupo(uint8_t grupo);
+
+/**
+ * @brief Estágio corrente (ou de destino, durante a transição)
+ *
+ * Durante a preempção vale num_estagios do plano.
+ */
+uint8_t fases_estagio_atual(void);
+
+/**
+ * @brief Número de ciclos completos desde o carregamento do plano
+ */
+uint32_t fases_ciclo(void);
+
+/**
+ * @brief Verde que resta ao estágio atual
+ *
+ * No controle atuado é o limite até o verde máximo: detectores e chamadas
+ * de pedestre podem encerrar o verde antes. Zero durante as transições e
+ * no modo intermitente.
+ *
+ * @param agora_ms Tempo atual em ms
+ */
+uint32_t fases_verde_restante_ms(uint32_t agora_ms);
+
+/**
+ * @brief Registra a chamada de pedestre de um grupo
+ *
+ * Pode ser chamada de outra task: apenas marca a chamada, que é tratada na
+ * próxima fases_atualizar().
+ *
+ * @param grupo Grupo de pedestres
+ * @param instante_ms Instante do acionamento da botoeira
+ * @return true se a chamada ficou registrada (ou já estava)
+ */
+bool fases_chamada_pedestre(uint8_t grupo, uint32_t instante_ms);
+
+/**
+ * @brief Indica se o grupo tem chamada aguardando atendimento
+ */
+bool fases_chamada_pendente(uint8_t grupo);
+
+/**
+ * @brief Copia as estatísticas de atendimento das chamadas de um grupo
+ *
+ * @return false se o grupo não existe
+ */
+bool fases_estatisticas_chamada(uint8_t grupo, EstatisticasChamada *saida);
+
+/**
+ * @brief Copia os atrasos das trocas desde o boot
+ */
+void fases_atraso_trocas(AtrasoTrocas *saida);
+
+/**
+ * @brief Inicia a preempção: troca segura para o estágio de preempção
+ *
+ * Os focos que já podem mudar (verdes que vão para amarelo) são acionados
+ * antes do retorno.
+ *
+ * @param agora_ms Tempo atual em ms
+ * @return false se o plano não tem estágio de preempção
+ */
+bool fases_preemptar(uint32_t agora_ms);
+
+/**
+ * @brief Encerra a preempção e retoma o estágio interrompido
+ */
+void fases_encerrar_preempcao(uint32_t agora_ms);
+
+/**
+ * @brief Instantes (relogio_us) em que o motor trocou as saídas da preempção em curso
+ *
+ * @param resposta_us Primeira saída trocada (0 enquanto nenhuma; se nenhuma
+ *                    precisou mudar, o instante do verde)
+ * @param verde_us Última saída do estágio de preempção em verde (0 enquanto não)
+ * @return false se não há preempção ativa
+ */
+bool fases_instantes_preempcao(uint64_t *resposta_us, uint64_t *verde_us);
+
+/**
+ * @brief Pior caso, em ms, entre fases_preemptar() e o verde da preempção
+ *
+ * Maior entreverde (ou amarelo) que precede algum grupo do estágio de
+ * preempção; não inclui o período de chamada de fases_atualizar().
+ */
+uint32_t fases_limite_preempcao_ms(void);
+
+/**
+ * @brief Indica se algum grupo do plano usa pixels da matriz
+ */
+bool fases_usa_matriz(void);
+
+/**
+ * @brief Desenha na matriz os grupos com saída SAIDA_PIXEL_MATRIZ
+ *
+ * Deve ser chamada pela task que controla a matriz.
+ */
+void fases_desenhar_matriz(void);
+
+/**
+ * @brief Modo intermitente: focos veiculares em amarelo aceso/apagado
+ *
+ * Pedestres ficam apagados. Usado no modo noturno; o motor volta a
+ * controlar as saídas em fases_carregar_plano(). O LED RGB acende e apaga
+ * com um fade de FASES_FADE_PISCA_MS. Apagado, os slices PWM das saídas
+ * ficam desligados até o próximo aceso.
+ *
+ * @param aceso true para acender o amarelo
+ */
+void fases_intermitente(bool aceso);
+
+#endif /* FASES_H_ */
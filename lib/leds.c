@@ -1,67 +1,356 @@
 #include "leds.h"
 #include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/clocks.h"
 #include "matrizRGB.h"
+#include "traco.h"
 #include <stdio.h>
 #include <stdlib.h>
 
+#define NIVEL_MAXIMO 4095 // Wrap do PWM: mesma resolução do ADC (12 bits)
+#define NUM_PINOS 3
 
-// Configuração do PWM
-static uint slice_num_red;
-static uint slice_num_green;
-static uint slice_num_blue;
+// round(4095 * (i / 255)^2.2): nível do PWM para cada posição perceptiva
+static const uint16_t gamma_12bits[256] = {
+    0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 7, 8,
+    9, 11, 12, 14, 15, 17, 19, 21, 23, 25, 27, 29, 32, 34, 37, 40,
+    43, 46, 49, 52, 55, 59, 62, 66, 70, 73, 77, 82, 86, 90, 95, 99,
+    104, 109, 114, 119, 124, 129, 135, 140, 146, 152, 158, 164, 170, 176, 182, 189,
+    196, 202, 209, 216, 224, 231, 238, 246, 254, 261, 269, 277, 286, 294, 302, 311,
+    320, 328, 337, 347, 356, 365, 375, 384, 394, 404, 414, 424, 435, 445, 456, 467,
+    477, 488, 500, 511, 522, 534, 545, 557, 569, 581, 594, 606, 619, 631, 644, 657,
+    670, 683, 697, 710, 724, 738, 752, 766, 780, 794, 809, 823, 838, 853, 868, 884,
+    899, 914, 930, 946, 962, 978, 994, 1011, 1027, 1044, 1061, 1078, 1095, 1112, 1130, 1147,
+    1165, 1183, 1201, 1219, 1237, 1256, 1274, 1293, 1312, 1331, 1350, 1370, 1389, 1409, 1429, 1449,
+    1469, 1489, 1509, 1530, 1551, 1572, 1593, 1614, 1635, 1657, 1678, 1700, 1722, 1744, 1766, 1789,
+    1811, 1834, 1857, 1880, 1903, 1926, 1950, 1974, 1997, 2021, 2045, 2070, 2094, 2119, 2143, 2168,
+    2193, 2219, 2244, 2270, 2295, 2321, 2347, 2373, 2400, 2426, 2453, 2479, 2506, 2534, 2561, 2588,
+    2616, 2644, 2671, 2700, 2728, 2756, 2785, 2813, 2842, 2871, 2900, 2930, 2959, 2989, 3019, 3049,
+    3079, 3109, 3140, 3170, 3201, 3232, 3263, 3295, 3326, 3358, 3390, 3421, 3454, 3486, 3518, 3551,
+    3584, 3617, 3650, 3683, 3716, 3750, 3784, 3818, 3852, 3886, 3920, 3955, 3990, 4025, 4060, 4095,
+};
+
+// Rampa de um slice: uma palavra do registrador CC (A nos 16 bits baixos, B nos altos) por wrap.
+// O DMA escreve a palavra inteira: o canal do slice que não é do LED fica em 0 no fade.
+typedef struct
+{
+    uint slice;
+    int canal_dma;
+    uint32_t passos[LED_FADE_MAX_MS];
+} RampaSlice;
+
+// Na ordem dos componentes de npColor_t
+static const uint pinos[NUM_PINOS] = {LED_RED_PIN, LED_GREEN_PIN, LED_BLUE_PIN};
+
+static RampaSlice rampas[NUM_PINOS];
+static uint8_t num_rampas = 0;
+static uint8_t rampa_do_pino[NUM_PINOS];
+
+static uint16_t niveis[NUM_PINOS];         // Níveis aplicados (no fade, os do início)
+static uint16_t niveis_destino[NUM_PINOS]; // Níveis no fim do fade em andamento
+static uint32_t passos_fade = 0;
+static volatile uint8_t rampas_pendentes = 0; // Bit por rampa com DMA em andamento
+static AvisoFade aviso_fade = NULL;
+static bool slices_ligados = false;
+static npColor_t cor_atual = {0, 0, 0}; // Última cor pedida (no fade, a de destino)
+static uint8_t brilho = 255;
+
+static inline uint16_t nivel_linear(uint8_t componente)
+{
+    return (uint16_t)((uint32_t)componente * brilho * NIVEL_MAXIMO / (255u * 255u));
+}
+
+/**
+ * @brief Nível do PWM numa posição perceptiva em ponto fixo 8.8 (0 a 255.0)
+ */
+static uint16_t nivel_gamma(int32_t posicao)
+{
+    int32_t i = posicao >> 8;
+    if (i >= 255)
+        return gamma_12bits[255];
+    int32_t diferenca = gamma_12bits[i + 1] - gamma_12bits[i];
+    return (uint16_t)(gamma_12bits[i] + ((diferenca * (posicao & 0xff)) >> 8));
+}
+
+/**
+ * @brief Inverso de nivel_gamma(): busca binária na tabela e interpolação
+ */
+static int32_t posicao_gamma(uint16_t nivel)
+{
+    int32_t baixo = 0, alto = 255; // Maior i com gamma_12bits[i] <= nivel
+    while (baixo < alto)
+    {
+        int32_t meio = (baixo + alto + 1) / 2;
+        if (gamma_12bits[meio] <= nivel)
+            baixo = meio;
+        else
+            alto = meio - 1;
+    }
+    if (baixo == 255)
+        return 255 << 8;
+    int32_t diferenca = gamma_12bits[baixo + 1] - gamma_12bits[baixo];
+    return (baixo << 8) + (int32_t)(nivel - gamma_12bits[baixo]) * 256 / diferenca;
+}
+
+static bool apagado(const uint16_t n[NUM_PINOS])
+{
+    return n[0] == 0 && n[1] == 0 && n[2] == 0;
+}
+
+static void ligar_slices(bool ligar)
+{
+    if (ligar == slices_ligados)
+        return;
+    slices_ligados = ligar;
+    for (int k = 0; k < NUM_PINOS; k++)
+        led_pwm_pino(pinos[k], ligar);
+}
+
+/**
+ * @brief Interrompe o fade em andamento, deixando em `niveis` o último passo copiado
+ */
+static void parar_fade(void)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    for (uint8_t r = 0; r < num_rampas && rampas_pendentes; r++)
+    {
+        if (!(rampas_pendentes & (1u << r)))
+        {
+            // Esta rampa já terminou: seus pinos estão no destino
+            for (int k = 0; k < NUM_PINOS; k++)
+                if (rampa_do_pino[k] == r)
+                    niveis[k] = niveis_destino[k];
+            continue;
+        }
+
+        // Sem a IRQ durante o abort, que pode sinalizar um fim espúrio (RP2040-E13)
+        uint canal = (uint)rampas[r].canal_dma;
+        dma_channel_set_irq0_enabled(canal, false);
+        dma_channel_abort(canal);
+        dma_channel_acknowledge_irq0(canal);
+
+        uint32_t feitos = passos_fade - dma_hw->ch[canal].transfer_count;
+        if (feitos == 0)
+            continue;
+        uint32_t cc = rampas[r].passos[feitos - 1];
+        for (int k = 0; k < NUM_PINOS; k++)
+            if (rampa_do_pino[k] == r)
+                niveis[k] = (uint16_t)(cc >> (16 * pwm_gpio_to_channel(pinos[k])));
+    }
+    rampas_pendentes = 0;
+    restore_interrupts(estado);
+}
+
+/**
+ * @brief Fim dos canais de uma rampa (DMA_IRQ_0, compartilhada com o áudio)
+ */
+static void led_dma_irq(void)
+{
+    bool terminou = false;
+    for (uint8_t r = 0; r < num_rampas; r++)
+    {
+        uint canal = (uint)rampas[r].canal_dma;
+        if ((rampas_pendentes & (1u << r)) && dma_channel_get_irq0_status(canal))
+        {
+            dma_channel_acknowledge_irq0(canal);
+            rampas_pendentes &= (uint8_t)~(1u << r);
+            terminou = rampas_pendentes == 0;
+        }
+    }
+    if (!terminou)
+        return;
+
+    for (int k = 0; k < NUM_PINOS; k++)
+        niveis[k] = niveis_destino[k];
+    if (apagado(niveis))
+        ligar_slices(false);
+
+    BaseType_t acordar = pdFALSE;
+    if (aviso_fade != NULL)
+        aviso_fade(&acordar);
+    portYIELD_FROM_ISR(acordar);
+}
+
+/**
+ * @brief Aplica níveis na hora, parando o fade e os slices se tudo apagar
+ */
+static void aplicar_niveis(const uint16_t novos[NUM_PINOS])
+{
+    parar_fade();
+    for (int k = 0; k < NUM_PINOS; k++)
+        niveis[k] = novos[k];
+
+    if (!apagado(niveis))
+        ligar_slices(true);
+    for (int k = 0; k < NUM_PINOS; k++)
+        pwm_set_gpio_level(pinos[k], niveis[k]);
+    if (apagado(niveis))
+        ligar_slices(false);
+}
 
 void led_init(void)
 {
-    // Configurar os pinos como PWM
-    gpio_set_function(LED_RED_PIN, GPIO_FUNC_PWM);
-    gpio_set_function(LED_GREEN_PIN, GPIO_FUNC_PWM);
-    gpio_set_function(LED_BLUE_PIN, GPIO_FUNC_PWM);
-    
-    // Obter os números dos slices PWM para cada pino
-    slice_num_red = pwm_gpio_to_slice_num(LED_RED_PIN);
-    slice_num_green = pwm_gpio_to_slice_num(LED_GREEN_PIN);
-    slice_num_blue = pwm_gpio_to_slice_num(LED_BLUE_PIN);
-    
-    // Configurar o PWM para cada slice
     pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, 1.0f); // Define o divisor de clock para evitar flickering
-    pwm_config_set_wrap(&config, 4095);   // Mesma resolução do ADC (12 bits)
-    
-    // Inicializar PWM para cada slice e ativar
-    pwm_init(slice_num_red, &config, true);
-    pwm_init(slice_num_green, &config, true);
-    pwm_init(slice_num_blue, &config, true);
-    
+    pwm_config_set_clkdiv(&config, (float)clock_get_hz(clk_sys) / (float)((NIVEL_MAXIMO + 1) * LED_PWM_WRAP_HZ));
+    pwm_config_set_wrap(&config, NIVEL_MAXIMO);
+
+    // Uma rampa (e um canal de DMA) por slice; azul e vermelho dividem o slice 6
+    num_rampas = 0;
+    for (int k = 0; k < NUM_PINOS; k++)
+    {
+        uint slice = pwm_gpio_to_slice_num(pinos[k]);
+        uint8_t r = 0;
+        while (r < num_rampas && rampas[r].slice != slice)
+            r++;
+        if (r == num_rampas)
+        {
+            rampas[r].slice = slice;
+            rampas[r].canal_dma = dma_claim_unused_channel(true);
+            pwm_init(slice, &config, true);
+            num_rampas++;
+        }
+        rampa_do_pino[k] = r;
+        gpio_set_function(pinos[k], GPIO_FUNC_PWM);
+    }
+    slices_ligados = true;
+
+    irq_add_shared_handler(DMA_IRQ_0, led_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
     // Garantir que os LEDs comecem desligados
     turn_off_leds();
 }
 
-void força_leds(float dutycicle)
+void led_ajustar_clock(void)
+{
+    // Um wrap por passo do fade qualquer que seja o clk_sys
+    float divisor = (float)clock_get_hz(clk_sys) / (float)((NIVEL_MAXIMO + 1) * LED_PWM_WRAP_HZ);
+    for (uint8_t r = 0; r < num_rampas; r++)
+        pwm_set_clkdiv(rampas[r].slice, divisor);
+}
+
+void led_pwm_pino(uint pino, bool ligar)
+{
+    uint slice = pwm_gpio_to_slice_num(pino);
+    if (ligar)
+    {
+        pwm_set_enabled(slice, true);
+        gpio_set_function(pino, GPIO_FUNC_PWM);
+    }
+    else
+    {
+        // Com o slice parado o nível congelaria onde estivesse: o pino passa ao SIO em 0
+        gpio_put(pino, false);
+        gpio_set_dir(pino, GPIO_OUT);
+        gpio_set_function(pino, GPIO_FUNC_SIO);
+        pwm_set_enabled(slice, false);
+    }
+}
+
+void força_leds(uint8_t porcentagem)
 {
-    // Limitar o duty cycle entre 0 e 100%
-    if (dutycicle < 0.0f) dutycicle = 0.0f;
-    if (dutycicle > 100.0f) dutycicle = 100.0f;
-    
-    // Converter de porcentagem (0-100) para o valor do contador PWM (0-4095)
-    uint16_t valor_pwm = (uint16_t)((dutycicle / 100.0f) * 4095);
-    
+    // Limitar o duty cycle a 100%
+    if (porcentagem > 100)
+        porcentagem = 100;
+
     // Aplicar o mesmo duty cycle para todos os LEDs
-    pwm_set_gpio_level(LED_RED_PIN, valor_pwm);
-    pwm_set_gpio_level(LED_GREEN_PIN, valor_pwm);
-    pwm_set_gpio_level(LED_BLUE_PIN, valor_pwm);
+    uint8_t valor = (uint8_t)(porcentagem * 255 / 100);
+    acender_led_rgb(valor, valor, valor);
 }
 
 void acender_led_rgb(uint8_t r, uint8_t g, uint8_t b)
 {
-    // Converter os valores de 8 bits (0-255) para valores do contador PWM (0-4095)
-    uint16_t valor_r = (uint16_t)(r * 4095 / 255);
-    uint16_t valor_g = (uint16_t)(g * 4095 / 255);
-    uint16_t valor_b = (uint16_t)(b * 4095 / 255);
-    
-    // Configurar o nível PWM para cada cor
-    pwm_set_gpio_level(LED_RED_PIN, valor_r);
-    pwm_set_gpio_level(LED_GREEN_PIN, valor_g);
-    pwm_set_gpio_level(LED_BLUE_PIN, valor_b);
+    // Converter os valores de 8 bits (0-255) para valores do contador PWM (0-4095), com o brilho
+    const uint16_t novos[NUM_PINOS] = {nivel_linear(r), nivel_linear(g), nivel_linear(b)};
+    aplicar_niveis(novos);
+    cor_atual = (npColor_t){r, g, b};
+
+    traco_registrar(TRACO_LED, ((uint32_t)r << 16) | ((uint32_t)g << 8) | b);
+}
+
+void led_fade_to(npColor_t cor, uint32_t ms)
+{
+    uint32_t num_passos = ms * LED_PWM_WRAP_HZ / 1000u;
+    if (num_passos == 0)
+    {
+        acender_led_rgb_cor(cor);
+        return;
+    }
+    if (num_passos > LED_FADE_MAX_MS)
+        num_passos = LED_FADE_MAX_MS;
+
+    parar_fade();
+    cor_atual = cor;
+    const uint8_t componentes[NUM_PINOS] = {cor.r, cor.g, cor.b};
+
+    for (uint8_t r = 0; r < num_rampas; r++)
+        for (uint32_t i = 0; i < num_passos; i++)
+            rampas[r].passos[i] = 0;
+
+    // Interpolação linear na posição perceptiva, em 8.16; o último passo é o nível exato
+    for (int k = 0; k < NUM_PINOS; k++)
+    {
+        niveis_destino[k] = nivel_linear(componentes[k]);
+        int32_t inicio = posicao_gamma(niveis[k]) << 8;
+        int32_t passo = ((posicao_gamma(niveis_destino[k]) << 8) - inicio) / (int32_t)num_passos;
+        uint32_t *palavras = rampas[rampa_do_pino[k]].passos;
+        uint deslocamento = 16 * pwm_gpio_to_channel(pinos[k]);
+
+        int32_t posicao = inicio;
+        for (uint32_t i = 0; i + 1 < num_passos; i++)
+        {
+            posicao += passo;
+            palavras[i] |= (uint32_t)nivel_gamma(posicao >> 8) << deslocamento;
+        }
+        palavras[num_passos - 1] |= (uint32_t)niveis_destino[k] << deslocamento;
+    }
+
+    uint32_t estado = save_and_disable_interrupts();
+    passos_fade = num_passos;
+    uint32_t mascara = 0;
+    for (uint8_t r = 0; r < num_rampas; r++)
+    {
+        uint canal = (uint)rampas[r].canal_dma;
+        dma_channel_config c = dma_channel_get_default_config(canal);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, PWM_DREQ_NUM(rampas[r].slice));
+        dma_channel_configure(canal, &c, &pwm_hw->slice[rampas[r].slice].cc, rampas[r].passos, num_passos, false);
+        dma_channel_set_irq0_enabled(canal, true);
+        mascara |= 1u << canal;
+    }
+    rampas_pendentes = (uint8_t)((1u << num_rampas) - 1);
+    ligar_slices(true);
+    dma_start_channel_mask(mascara);
+    restore_interrupts(estado);
+
+    traco_registrar(TRACO_LED, ((uint32_t)cor.r << 16) | ((uint32_t)cor.g << 8) | cor.b);
+}
+
+void led_definir_brilho(uint8_t novo)
+{
+    if (novo == brilho)
+        return;
+    brilho = novo;
+
+    // Um fade em andamento termina no brilho antigo; o próximo já usa o novo
+    if (rampas_pendentes)
+        return;
+    const uint16_t novos[NUM_PINOS] = {nivel_linear(cor_atual.r), nivel_linear(cor_atual.g), nivel_linear(cor_atual.b)};
+    aplicar_niveis(novos);
+}
+
+void led_fade_definir_aviso(AvisoFade aviso)
+{
+    aviso_fade = aviso;
+}
+
+bool led_fade_ativo(void)
+{
+    return rampas_pendentes != 0;
 }
 
 void acender_led_rgb_cor(npColor_t cor)
@@ -79,7 +368,5 @@ void acender_led_rgb_cor_aleatoria(void)
 void turn_off_leds(void)
 {
     // Desligar todos os LEDs configurando o nível PWM para 0
-    pwm_set_gpio_level(LED_RED_PIN, 0);
-    pwm_set_gpio_level(LED_GREEN_PIN, 0);
-    pwm_set_gpio_level(LED_BLUE_PIN, 0);
-}
\ No newline at end of file
+    acender_led_rgb(0, 0, 0);
+}
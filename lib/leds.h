@@ -3,18 +3,51 @@
 #define LED_CONTROL_H
 
 #include "pico/stdlib.h"
+#include "FreeRTOS.h"
 #include "matrizRGB.h"
 
 #define LED_GREEN_PIN 11
 #define LED_BLUE_PIN 12
 #define LED_RED_PIN 13
 
+// Frequência do PWM do LED RGB: cada wrap do contador é um passo de fade
+#define LED_PWM_WRAP_HZ 1000
+// Passos (ms) no maior fade; fades mais longos são encurtados
+#define LED_FADE_MAX_MS 512
+
+// Chamado na interrupção do DMA quando um fade chega à cor final
+typedef void (*AvisoFade)(BaseType_t *acordar);
+
 // Inicialização dos LEDs
 void led_init(void);
-void força_leds(float dutycicle);
+void força_leds(uint8_t porcentagem);
 void acender_led_rgb(uint8_t r, uint8_t g, uint8_t b);
 void turn_off_leds(void);
 void acender_led_rgb_cor(npColor_t cor);
 void acender_led_rgb_cor_aleatoria(void);
 
-#endif // LED_CONTROL_H
\ No newline at end of file
+/**
+ * Fade da cor atual até `cor` em `ms` milissegundos, sem a CPU
+ *
+ * Os níveis de cada passo saem de uma rampa com correção de gama (2,2),
+ * calculada aqui e copiada pelo DMA para os registradores de comparação,
+ * uma palavra a cada wrap do slice. Um fade novo ou um acender_led_rgb()
+ * interrompem o anterior na cor em que ele estava. Com ms = 0 a troca é
+ * imediata e não há aviso.
+ */
+void led_fade_to(npColor_t cor, uint32_t ms);
+// Registra a função chamada no fim de cada fade (NULL desliga)
+void led_fade_definir_aviso(AvisoFade aviso);
+// Há um fade em andamento
+bool led_fade_ativo(void);
+
+// Brilho global (0-255) aplicado a todas as cores; reaplica a cor atual
+void led_definir_brilho(uint8_t brilho);
+
+// Refaz o divisor do PWM depois de uma troca do clk_sys (energia_avisar_clock)
+void led_ajustar_clock(void);
+
+// Liga/desliga o slice PWM de um pino; desligado, o pino fica em nível baixo
+void led_pwm_pino(uint pino, bool ligar);
+
+#endif // LED_CONTROL_H
@@ -12,7 +12,12 @@
 #include "matrizRGB.h"
 #include "hardware/pio.h"
 #include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pwm.h"
+#include "hardware/irq.h"
 #include "ws2818b.pio.h" // Arquivo gerado pelo compilador PIO
+#include "traco.h"
+#include "perfil_barramento.h"
 
 /* Estado global da matriz de LEDs */
 npLED_t leds[NP_LED_COUNT];
@@ -23,10 +28,54 @@ const npColor_t npColors[] = {
     COLOR_YELLOW, COLOR_CYAN, COLOR_MAGENTA, COLOR_PURPLE, COLOR_ORANGE,
     COLOR_BROWN, COLOR_VIOLET, COLOR_GREY, COLOR_GOLD, COLOR_SILVER};
 
+/* Taxa de bits do WS2812B */
+#define NP_FREQ_HZ 800000.0f
+
+/* Bytes de um quadro, na ordem de envio (G, R, B de cada LED) */
+#define NP_FRAME_BYTES (NP_LED_COUNT * 3)
+
+/* Reset do WS2812B (LOW >= 280 us nas versões novas), com folga para o FIFO esvaziar */
+#define NP_RESET_US 400
+
+/* Contagem do canal de controle: um sub-quadro por transferência (~62 dias a 800 Hz), rearmada pela IRQ */
+#define NP_CONTROL_TRANSFERS UINT32_MAX
+
+/* Brilho global: componente do buffer -> componente enviado, em ponto fixo 8.4 */
+static uint16_t brightnessLut[256];
+static uint8_t brightnessLevel = 0; // 0 até a primeira npSetBrightness(): tabela vazia
+
+/*
+ * Dithering temporal: dois conjuntos de sub-quadros (um tocando, outro sendo
+ * montado) e, para cada um, a tabela de endereços que o canal de controle
+ * copia para o disparo do canal de dados, um sub-quadro por wrap do slice.
+ * A tabela é lida em anel, então precisa estar alinhada ao seu tamanho.
+ */
+static uint8_t subframes[2][NP_DITHER_SUBFRAMES][NP_FRAME_BYTES];
+static const uint8_t *subframeTables[2][NP_DITHER_SUBFRAMES] __attribute__((aligned(sizeof(void *) * NP_DITHER_SUBFRAMES)));
+static uint8_t ditherError[NP_FRAME_BYTES]; // Fração acumulada de cada componente (4 bits)
+static uint8_t playing = 0;                 // Conjunto no laço de DMA
+static uint32_t swapCount = 0;              // Contagem do canal de controle logo depois da última troca
+static bool refreshing = false;
+static int dmaData = -1;
+static int dmaControl = -1;
+
 /* Estado interno do hardware PIO */
 static PIO np_pio = NULL; // Instância PIO utilizada
 static uint sm = 0;       // State Machine utilizada
 
+/**
+ * @brief Fim da contagem do canal de controle: rearma o laço no mesmo ponto da tabela
+ */
+static void npControlIrq(void)
+{
+    if (dma_channel_get_irq1_status(dmaControl))
+    {
+        dma_channel_acknowledge_irq1(dmaControl);
+        if (refreshing)
+            dma_channel_set_trans_count(dmaControl, NP_CONTROL_TRANSFERS, true);
+    }
+}
+
 /**
  * @brief Converte coordenadas (x,y) para índice no array linear de LEDs
  *
@@ -74,21 +123,180 @@ void npInit(uint8_t pin)
     }
 
     // Inicializa o programa PIO com a frequência de 800kHz (padrão WS2812B)
-    ws2818b_program_init(np_pio, sm, offset, pin, 800000.0f);
+    ws2818b_program_init(np_pio, sm, offset, pin, NP_FREQ_HZ);
+
+    // Laço do dithering: dados (sub-quadro -> FIFO, pago pelo PIO) e controle
+    // (endereço do próximo sub-quadro -> disparo dos dados, pago pelo slice PWM)
+    dmaData = dma_claim_unused_channel(true);
+    dmaControl = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(dmaData);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(np_pio, sm, true));
+    dma_channel_configure(dmaData, &c, &np_pio->txf[sm], NULL, NP_FRAME_BYTES, false);
+
+    c = dma_channel_get_default_config(dmaControl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_ring(&c, false, __builtin_ctz(sizeof(subframeTables[0])));
+    channel_config_set_dreq(&c, PWM_DREQ_NUM(NP_REFRESH_PWM_SLICE));
+    dma_channel_configure(dmaControl, &c, &dma_hw->ch[dmaData].al3_read_addr_trig, subframeTables[0], 0, false);
+
+    for (int set = 0; set < 2; set++)
+        for (int s = 0; s < NP_DITHER_SUBFRAMES; s++)
+            subframeTables[set][s] = subframes[set][s];
+
+    // Todo handler compartilhado (DMA ou GPIO, em qualquer linha) ocupa uma vaga do mesmo
+    // conjunto de PICO_MAX_SHARED_IRQ_HANDLERS, ampliado no CMakeLists.txt. Na DMA_IRQ_1 este
+    // fica fora da cadeia da DMA_IRQ_0 (áudio, LEDs, ADC e I2C)
+    dma_channel_set_irq1_enabled(dmaControl, true);
+    irq_add_shared_handler(DMA_IRQ_1, npControlIrq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    // O slice só conta (nenhum pino em função PWM) e fica parado fora do dithering
+    pwm_config config = pwm_get_default_config();
+    pwm_init(NP_REFRESH_PWM_SLICE, &config, false);
+
+    // Brilho total até o primeiro ajuste
+    npSetBrightness(255);
 
     // Limpa a matriz, iniciando com todos os LEDs apagados
     npClear();
 }
 
+/**
+ * @brief Divisor e wrap do slice temporizador para NP_REFRESH_HZ no clk_sys atual
+ */
+static void npSetRefreshTimer(void)
+{
+    uint32_t ciclos = clock_get_hz(clk_sys) / NP_REFRESH_HZ;
+    uint32_t divisor = (ciclos + 0xffff) / 0x10000; // Menor divisor inteiro com wrap em 16 bits
+    pwm_set_clkdiv(NP_REFRESH_PWM_SLICE, (float)divisor);
+    pwm_set_wrap(NP_REFRESH_PWM_SLICE, (uint16_t)(ciclos / divisor - 1));
+}
+
+void npUpdateClock(void)
+{
+    // Mesmo cálculo de ws2818b_program_init(): 10 ciclos do PIO por bit
+    pio_sm_set_clkdiv(np_pio, sm, clock_get_hz(clk_sys) / (10.f * NP_FREQ_HZ));
+    npSetRefreshTimer();
+}
+
+/**
+ * @brief Monta os sub-quadros de um conjunto a partir do buffer de LEDs
+ *
+ * Cada componente vale inteiro + fração (8.4) depois do brilho. A fração
+ * soma no acumulador do componente a cada sub-quadro e, quando passa de
+ * um, o sub-quadro leva um LSB a mais; o resto fica para o próximo quadro.
+ *
+ * @return true se algum componente tem fração (o dithering é necessário)
+ */
+static bool npBuildSubframes(uint8_t set)
+{
+    const uint8_t *componentes = (const uint8_t *)leds; // G, R, B por LED, na ordem de envio
+    bool fracionario = false;
+
+    for (uint c = 0; c < NP_FRAME_BYTES; c++)
+    {
+        uint16_t valor = brightnessLut[componentes[c]];
+        uint8_t inteiro = (uint8_t)(valor >> 4);
+        uint8_t fracao = valor & 0x0f;
+        uint8_t erro = ditherError[c];
+        fracionario |= fracao != 0;
+
+        for (uint s = 0; s < NP_DITHER_SUBFRAMES; s++)
+        {
+            erro += fracao;
+            subframes[set][s][c] = inteiro + (erro >> 4);
+            erro &= 0x0f;
+        }
+        ditherError[c] = erro;
+    }
+    return fracionario;
+}
+
+/**
+ * @brief Liga o laço de DMA no conjunto indicado (ou só troca o conjunto)
+ */
+static void npStartRefresh(uint8_t set)
+{
+    // A troca da tabela vale a partir do próximo sub-quadro
+    dma_channel_set_read_addr(dmaControl, subframeTables[set], false);
+    playing = set;
+    if (refreshing)
+    {
+        swapCount = dma_channel_hw_addr(dmaControl)->transfer_count;
+        return;
+    }
+
+    npSetRefreshTimer();
+    refreshing = true;
+    dma_channel_set_trans_count(dmaControl, NP_CONTROL_TRANSFERS, true);
+    swapCount = NP_CONTROL_TRANSFERS;
+    pwm_set_enabled(NP_REFRESH_PWM_SLICE, true);
+}
+
+/**
+ * @brief Espera o canal de controle ler a tabela da última troca
+ *
+ * Até lá o laço ainda pode tocar o conjunto anterior, que é o que o
+ * próximo npWrite() remontaria. Leva no máximo um período de NP_REFRESH_HZ.
+ */
+static void npWaitSwap(void)
+{
+    while (refreshing && dma_channel_hw_addr(dmaControl)->transfer_count == swapCount)
+        busy_wait_us(1000000 / NP_REFRESH_HZ / 4);
+}
+
+/**
+ * @brief Para o laço de DMA depois do sub-quadro em curso e espera o reset
+ */
+static void npStopRefresh(void)
+{
+    if (!refreshing)
+        return;
+    pwm_set_enabled(NP_REFRESH_PWM_SLICE, false);
+    refreshing = false;
+
+    // Sem a IRQ durante o abort, que pode sinalizar um fim espúrio (RP2040-E13)
+    dma_channel_set_irq1_enabled(dmaControl, false);
+    dma_channel_abort(dmaControl);
+    dma_channel_acknowledge_irq1(dmaControl);
+    dma_channel_set_irq1_enabled(dmaControl, true);
+    while (dma_channel_is_busy(dmaData))
+        tight_loop_contents();
+    busy_wait_us(NP_RESET_US);
+}
+
+void npSetBrightness(uint8_t brightness)
+{
+    if (brightness == brightnessLevel)
+        return;
+    brightnessLevel = brightness;
+    for (uint v = 0; v < 256; v++)
+        brightnessLut[v] = (uint16_t)((v * brightness * 16u + 127u) / 255u);
+}
+
 void npWrite(void)
 {
-    // Envia os dados de cada LED para o hardware PIO na ordem correta (GRB)
-    for (uint i = 0; i < NP_LED_COUNT; ++i)
+    // Os sub-quadros vão para o conjunto que não está tocando, livre só depois da troca anterior
+    npWaitSwap();
+    uint8_t set = refreshing ? playing ^ 1u : 0;
+    if (npBuildSubframes(set))
+        npStartRefresh(set);
+    else
     {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+        // Sem frações todos os sub-quadros são iguais: envia o primeiro direto (GRB), já com o brilho
+        npStopRefresh();
+        uint64_t inicio = perfil_barramento_marcar();
+        for (uint c = 0; c < NP_FRAME_BYTES; ++c)
+            pio_sm_put_blocking(np_pio, sm, subframes[set][0][c]);
+        perfil_barramento_registrar(BARRAMENTO_PIO, NP_FRAME_BYTES, inicio);
     }
+    traco_registrar(TRACO_MATRIZ, traco_hash(leds, sizeof(leds)));
 }
 
 void npClear(void)
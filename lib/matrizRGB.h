@@ -29,6 +29,23 @@
 #define NP_MATRIX_WIDTH 5
 #define NP_MATRIX_HEIGHT 5
 
+/**
+ * @brief Dithering temporal: sub-quadros por ciclo (4 bits abaixo do LSB)
+ */
+#define NP_DITHER_SUBFRAMES 16
+
+/**
+ * @brief Sub-quadros enviados por segundo no dithering (ciclo de 50 Hz)
+ *
+ * Cada quadro leva 750 us a 800 kHz, mais o reset do WS2812B.
+ */
+#define NP_REFRESH_HZ 800
+
+/**
+ * @brief Slice PWM usado só como temporizador do DMA do dithering (sem pino)
+ */
+#define NP_REFRESH_PWM_SLICE 4
+
 /**
  * @brief Estrutura representando um LED RGB com componentes na ordem GRB
  * (ordem específica requerida pelo protocolo WS2812B)
@@ -83,11 +100,35 @@ extern npLED_t leds[NP_LED_COUNT];
  */
 void npInit(uint8_t pin);
 
+/**
+ * @brief Recalcula o divisor do PIO com o clk_sys atual
+ *
+ * Mantém os 800 kHz do WS2812B depois de uma troca de clock (ver
+ * lib/energia.h). Não deve ser chamada no meio de um npWrite().
+ */
+void npUpdateClock(void);
+
+/**
+ * @brief Define o brilho global da matriz (0-255, padrão 255)
+ *
+ * Refaz a tabela que escala cada componente na saída de npWrite(), com 4
+ * bits de fração; o buffer de LEDs não muda. Vale a partir do próximo
+ * npWrite().
+ */
+void npSetBrightness(uint8_t brightness);
+
 /**
  * @brief Envia os dados de cores atuais para a matriz de LEDs
  * 
  * Transmite o conteúdo atual do buffer de LEDs para o hardware,
  * atualizando visualmente o estado da matriz.
+ *
+ * Se o brilho deixa frações de LSB (ex.: componente 1 com brilho baixo),
+ * monta NP_DITHER_SUBFRAMES sub-quadros com um acumulador de erro por
+ * componente, e um laço de DMA os reenvia a NP_REFRESH_HZ, pago pelo wrap
+ * do slice NP_REFRESH_PWM_SLICE, sem a CPU. Sem frações, o laço para e o
+ * quadro vai direto pelo FIFO, como antes. Duas chamadas dentro do mesmo
+ * período do laço esperam (até 1/NP_REFRESH_HZ) a primeira entrar no ar.
  */
 void npWrite(void);
 
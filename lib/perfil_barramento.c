@@ -0,0 +1,152 @@
+/**
+ * @file perfil_barramento.c
+ * @brief Implementação do perfil de uso dos barramentos
+ */
+
+#include "perfil_barramento.h"
+
+#if PERFIL_BARRAMENTO_HABILITADO
+
+#include "hardware/sync.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "prioridades.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define PERFIL_PERIODO_MS 1000 // Janela de cada relatório
+#define NUM_BARRAMENTOS 2
+
+typedef struct
+{
+    uint32_t transacoes;
+    uint32_t bytes;
+    uint64_t ocupado_us;
+} Contadores;
+
+typedef struct
+{
+    TaskHandle_t task; // NULL = antes do escalonador (main)
+    bool usada;
+    Contadores barramentos[NUM_BARRAMENTOS];
+} EntradaTask;
+
+static const char *const nomes_barramento[NUM_BARRAMENTOS] = {"i2c", "pio"};
+
+// A última entrada recebe as tasks que não couberam na tabela
+static EntradaTask tabela[PERFIL_BARRAMENTO_MAX_TASKS + 1];
+
+/**
+ * @brief Entrada da task atual (cria uma se for a primeira transação dela)
+ *
+ * Chamada com as interrupções desabilitadas.
+ */
+static EntradaTask *entrada_atual(void)
+{
+    TaskHandle_t task = NULL;
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+        task = xTaskGetCurrentTaskHandle();
+
+    for (int i = 0; i < PERFIL_BARRAMENTO_MAX_TASKS; i++)
+    {
+        if (!tabela[i].usada)
+        {
+            tabela[i].usada = true;
+            tabela[i].task = task;
+            return &tabela[i];
+        }
+        if (tabela[i].task == task)
+            return &tabela[i];
+    }
+    return &tabela[PERFIL_BARRAMENTO_MAX_TASKS];
+}
+
+void perfil_barramento_registrar(Barramento barramento, size_t bytes, uint64_t inicio_us)
+{
+    uint64_t duracao = relogio_us() - inicio_us;
+    uint32_t estado = save_and_disable_interrupts();
+
+    Contadores *c = &entrada_atual()->barramentos[barramento];
+    c->transacoes++;
+    c->bytes += (uint32_t)bytes;
+    c->ocupado_us += duracao;
+
+    restore_interrupts(estado);
+}
+
+static const char *nome_entrada(int indice)
+{
+    if (indice == PERFIL_BARRAMENTO_MAX_TASKS)
+        return "outras";
+    if (tabela[indice].task == NULL)
+        return "main";
+    return pcTaskGetName(tabela[indice].task);
+}
+
+/**
+ * @brief Imprime uma linha do relatório; uso em décimos de porcento
+ */
+static void imprimir(uint64_t agora_us, int barramento, const char *nome, const Contadores *c, uint64_t janela_us)
+{
+    uint32_t permil = (uint32_t)(c->ocupado_us * 1000u / janela_us);
+    printf("@B %llu %s %s trans=%lu bytes=%lu ocupado_us=%llu uso=%lu.%lu%%\n", (unsigned long long)agora_us,
+           nomes_barramento[barramento], nome, (unsigned long)c->transacoes, (unsigned long)c->bytes,
+           (unsigned long long)c->ocupado_us, (unsigned long)(permil / 10), (unsigned long)(permil % 10));
+}
+
+/**
+ * @brief Task que fecha a janela a cada segundo e imprime o perfil
+ */
+static void tarefa_perfil(void *parametro)
+{
+    (void)parametro;
+    static EntradaTask copia[PERFIL_BARRAMENTO_MAX_TASKS + 1];
+    uint64_t inicio_janela = relogio_us();
+    TickType_t ultimo = xTaskGetTickCount();
+
+    while (true)
+    {
+        vTaskDelayUntil(&ultimo, pdMS_TO_TICKS(PERFIL_PERIODO_MS));
+
+        // Copia e zera a janela de uma vez, para as linhas fecharem com o total
+        uint32_t estado = save_and_disable_interrupts();
+        uint64_t agora = relogio_us();
+        for (int i = 0; i <= PERFIL_BARRAMENTO_MAX_TASKS; i++)
+        {
+            copia[i] = tabela[i];
+            for (int b = 0; b < NUM_BARRAMENTOS; b++)
+                tabela[i].barramentos[b] = (Contadores){0};
+        }
+        restore_interrupts(estado);
+
+        uint64_t janela = agora - inicio_janela;
+        inicio_janela = agora;
+        if (janela == 0)
+            continue;
+
+        for (int b = 0; b < NUM_BARRAMENTOS; b++)
+        {
+            Contadores total = {0};
+            for (int i = 0; i <= PERFIL_BARRAMENTO_MAX_TASKS; i++)
+            {
+                const Contadores *c = &copia[i].barramentos[b];
+                if (c->transacoes == 0)
+                    continue;
+                imprimir(agora, b, nome_entrada(i), c, janela);
+                total.transacoes += c->transacoes;
+                total.bytes += c->bytes;
+                total.ocupado_us += c->ocupado_us;
+            }
+            imprimir(agora, b, "total", &total, janela);
+        }
+    }
+}
+
+void perfil_barramento_iniciar(void)
+{
+    TaskHandle_t tarefa = NULL;
+    xTaskCreate(tarefa_perfil, "Perfil", configMINIMAL_STACK_SIZE, NULL, prioridades_de(PAPEL_TELEMETRIA), &tarefa);
+    prioridades_registrar(PAPEL_TELEMETRIA, tarefa);
+}
+
+#endif
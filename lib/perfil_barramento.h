@@ -0,0 +1,92 @@
+/**
+ * @file perfil_barramento.h
+ * @brief Perfil de uso dos barramentos I2C (OLED) e PIO (matriz) por task
+ *
+ * Os drivers marcam cada transação: a task do barramento I2C
+ * (lib/barramento_i2c.h) em volta de cada pedaço por DMA, o SSD1306 sem
+ * barramento em volta de i2c_write_timeout_us() (escrita direta, com
+ * prazo), npWrite() em volta dos pio_sm_put_blocking() do quadro inteiro.
+ * Para cada task que chamou são somadas transações, bytes e o tempo
+ * bloqueado na escrita.
+ *
+ * Uma vez por segundo sai uma linha por task e barramento com atividade, e
+ * uma linha de total:
+ *
+ *     @B <tempo_us> <barramento> <task> trans=<n> bytes=<n> ocupado_us=<n> uso=<%>
+ *
+ * "uso" é o tempo bloqueado sobre a janela de 1 s. No PIO o tempo é o de
+ * espera da FIFO, não o do fio: as últimas palavras de cada quadro ainda
+ * estão saindo quando npWrite() retorna. No I2C com barramento todo o
+ * tráfego aparece na task "I2C", e o tempo é o do DMA até o último byte
+ * entrar no FIFO, durante o qual ela dorme; quem pediu não espera nada.
+ *
+ * Só é compilado com PERFIL_BARRAMENTO_HABILITADO=1 (opção
+ * SEMAFORO_PERFIL_BARRAMENTO do CMake); sem ela as chamadas somem do binário.
+ */
+
+#ifndef PERFIL_BARRAMENTO_H_
+#define PERFIL_BARRAMENTO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef PERFIL_BARRAMENTO_HABILITADO
+#define PERFIL_BARRAMENTO_HABILITADO 0
+#endif
+
+/** @brief Tasks distintas acompanhadas; as demais somam em "outras" */
+#define PERFIL_BARRAMENTO_MAX_TASKS 8
+
+typedef enum
+{
+    BARRAMENTO_I2C = 0,
+    BARRAMENTO_PIO = 1,
+} Barramento;
+
+#if PERFIL_BARRAMENTO_HABILITADO
+
+#include "relogio.h"
+
+/**
+ * @brief Cria a task que imprime o perfil a cada segundo
+ *
+ * Deve ser chamada antes de vTaskStartScheduler().
+ */
+void perfil_barramento_iniciar(void);
+
+/**
+ * @brief Início de uma transação (tempo atual em µs)
+ */
+static inline uint64_t perfil_barramento_marcar(void)
+{
+    return relogio_us();
+}
+
+/**
+ * @brief Fim de uma transação, atribuída à task atual
+ *
+ * @param inicio_us Valor devolvido por perfil_barramento_marcar()
+ */
+void perfil_barramento_registrar(Barramento barramento, size_t bytes, uint64_t inicio_us);
+
+#else
+
+static inline void perfil_barramento_iniciar(void)
+{
+}
+
+static inline uint64_t perfil_barramento_marcar(void)
+{
+    return 0;
+}
+
+static inline void perfil_barramento_registrar(Barramento barramento, size_t bytes, uint64_t inicio_us)
+{
+    (void)barramento;
+    (void)bytes;
+    (void)inicio_us;
+}
+
+#endif
+
+#endif /* PERFIL_BARRAMENTO_H_ */
@@ -0,0 +1,91 @@
+/**
+ * @file preempcao.c
+ * @brief Implementação da entrada de preempção
+ */
+
+#include "preempcao.h"
+#include "comandos.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include <stdio.h>
+
+static uint pino_preempcao;
+static volatile bool solicitada = false; // Comando postado e ainda não tratado
+static EstatisticasPreempcao estatisticas;
+
+/**
+ * @brief Borda de descida da entrada (contexto de interrupção)
+ *
+ * Só a primeira borda de uma solicitação vira comando: os repiques do
+ * contato não reiniciam a medição. Se a fila estiver cheia, a próxima borda
+ * tenta de novo.
+ */
+static void preempcao_gpio_irq(void)
+{
+    if (!(gpio_get_irq_event_mask(pino_preempcao) & GPIO_IRQ_EDGE_FALL))
+        return;
+
+    gpio_acknowledge_irq(pino_preempcao, GPIO_IRQ_EDGE_FALL);
+    if (solicitada)
+        return;
+
+    Comando comando = {.tipo = COMANDO_PREEMPCAO, .origem = ORIGEM_PREEMPCAO, .instante_us = time_us_64()};
+    BaseType_t acordar = pdFALSE;
+    solicitada = comandos_enviar_de_isr(&comando, &acordar);
+    portYIELD_FROM_ISR(acordar);
+}
+
+void preempcao_iniciar(uint pino)
+{
+    pino_preempcao = pino;
+
+    gpio_init(pino);
+    gpio_set_dir(pino, GPIO_IN);
+    gpio_pull_up(pino);
+
+    gpio_add_raw_irq_handler(pino, preempcao_gpio_irq);
+    gpio_acknowledge_irq(pino, GPIO_IRQ_EDGE_FALL);
+    gpio_set_irq_enabled(pino, GPIO_IRQ_EDGE_FALL, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void preempcao_rearmar(void)
+{
+    solicitada = false;
+}
+
+bool preempcao_entrada_ativa(void)
+{
+    return !gpio_get(pino_preempcao);
+}
+
+void preempcao_registrar_resposta(uint64_t borda_us, uint64_t agora_us)
+{
+    uint32_t latencia = (uint32_t)(agora_us - borda_us);
+
+    estatisticas.acionamentos++;
+    estatisticas.resposta_ultima_us = latencia;
+    if (latencia > estatisticas.resposta_max_us)
+        estatisticas.resposta_max_us = latencia;
+}
+
+void preempcao_registrar_verde(uint64_t borda_us, uint64_t agora_us, uint32_t limite_us)
+{
+    uint32_t latencia = (uint32_t)(agora_us - borda_us);
+
+    estatisticas.verde_ultimo_us = latencia;
+    if (latencia > estatisticas.verde_max_us)
+        estatisticas.verde_max_us = latencia;
+
+    // Linha fixa para coleta pela serial
+    printf("preempcao: n=%lu resposta_us=%lu resposta_max_us=%lu verde_us=%lu verde_max_us=%lu limite_us=%lu\n",
+           (unsigned long)estatisticas.acionamentos,
+           (unsigned long)estatisticas.resposta_ultima_us, (unsigned long)estatisticas.resposta_max_us,
+           (unsigned long)estatisticas.verde_ultimo_us, (unsigned long)estatisticas.verde_max_us,
+           (unsigned long)limite_us);
+}
+
+void preempcao_estatisticas(EstatisticasPreempcao *saida)
+{
+    *saida = estatisticas;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file preempcao.h
+ * @brief Entrada de preempção para veículos de emergência
+ *
+ * A borda ativa da entrada é tratada por um handler de GPIO próprio, sem
+ * janela de debounce: o handler posta um COMANDO_PREEMPCAO com o instante
+ * da borda (lib/comandos.h), o que acorda na hora a task do controlador (a
+ * de maior prioridade), que inicia a troca segura no motor de fases. O
+ * controlador informa os instantes, tomados pelo motor de fases ao trocar
+ * as saídas, em que os focos reagiram e em que o verde da preempção acendeu;
+ * as latências medidas a partir da borda, que incluem a espera do comando
+ * na fila, ficam disponíveis para certificação.
+ */
+
+#ifndef PREEMPCAO_H_
+#define PREEMPCAO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/**
+ * @brief Latências medidas desde a borda da entrada (µs)
+ */
+typedef struct
+{
+    uint32_t acionamentos;
+    uint32_t resposta_ultima_us; /**< Borda -> primeira mudança dos focos */
+    uint32_t resposta_max_us;
+    uint32_t verde_ultimo_us;    /**< Borda -> verde da preempção */
+    uint32_t verde_max_us;
+} EstatisticasPreempcao;
+
+/**
+ * @brief Configura o pino (ativo em nível baixo) e a interrupção de borda
+ *
+ * Deve ser chamada depois de comandos_iniciar().
+ *
+ * @param pino GPIO da entrada de preempção
+ */
+void preempcao_iniciar(uint pino);
+
+/**
+ * @brief Libera o envio de um novo comando pela próxima borda
+ *
+ * Chamada pelo controlador ao tratar o COMANDO_PREEMPCAO. Até lá os
+ * repiques do contato não postam outros comandos.
+ */
+void preempcao_rearmar(void);
+
+/**
+ * @brief Nível atual da entrada (true = ativa)
+ */
+bool preempcao_entrada_ativa(void);
+
+/**
+ * @brief Registra o instante em que os focos reagiram à preempção
+ */
+void preempcao_registrar_resposta(uint64_t borda_us, uint64_t agora_us);
+
+/**
+ * @brief Registra o instante do verde da preempção e imprime as latências
+ *
+ * @param limite_us Pior caso esperado, impresso junto para conferência
+ */
+void preempcao_registrar_verde(uint64_t borda_us, uint64_t agora_us, uint32_t limite_us);
+
+/**
+ * @brief Copia as latências acumuladas
+ */
+void preempcao_estatisticas(EstatisticasPreempcao *saida);
+
+#endif /* PREEMPCAO_H_ */
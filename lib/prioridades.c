@@ -0,0 +1,71 @@
+/**
+ * @file prioridades.c
+ * @brief Implementação da tabela de prioridades
+ */
+
+#include "prioridades.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+
+typedef struct
+{
+    const char *nome;
+    UBaseType_t prioridade;
+} NivelPrioridade;
+
+// Do mais urgente ao menos urgente; a ordem é a de PapelTask
+static const NivelPrioridade tabela[NUM_PAPEIS] = {
+    [PAPEL_ENTRADAS] = {"entradas", tskIDLE_PRIORITY + 6},
+    [PAPEL_CONTROLE] = {"controle", tskIDLE_PRIORITY + 5},
+    [PAPEL_SAIDAS] = {"saidas", tskIDLE_PRIORITY + 4},
+    [PAPEL_BARRAMENTO] = {"barramento", tskIDLE_PRIORITY + 3},
+    [PAPEL_DISPLAY] = {"display", tskIDLE_PRIORITY + 2},
+    [PAPEL_TELEMETRIA] = {"telemetria", tskIDLE_PRIORITY + 1},
+};
+
+typedef struct
+{
+    PapelTask papel;
+    TaskHandle_t tarefa;
+} TaskRegistrada;
+
+static TaskRegistrada registradas[PRIORIDADES_MAX_TASKS];
+static uint8_t num_registradas = 0;
+
+UBaseType_t prioridades_de(PapelTask papel)
+{
+    return tabela[papel].prioridade;
+}
+
+void prioridades_registrar(PapelTask papel, TaskHandle_t tarefa)
+{
+    if (num_registradas >= PRIORIDADES_MAX_TASKS)
+        panic("prioridades: tasks demais");
+    registradas[num_registradas++] = (TaskRegistrada){papel, tarefa};
+}
+
+void prioridades_verificar(void)
+{
+    for (int p = 0; p < NUM_PAPEIS; p++)
+    {
+        UBaseType_t prioridade = tabela[p].prioridade;
+        if (prioridade <= tskIDLE_PRIORITY || prioridade >= configMAX_PRIORITIES)
+            panic("prioridades: %s fora da faixa", tabela[p].nome);
+        if (p > 0 && prioridade >= tabela[p - 1].prioridade)
+            panic("prioridades: %s nao esta abaixo de %s", tabela[p].nome, tabela[p - 1].nome);
+    }
+
+    for (uint8_t i = 0; i < num_registradas; i++)
+    {
+        const TaskRegistrada *r = &registradas[i];
+        if (r->tarefa == NULL)
+            panic("prioridades: task de %s nao foi criada", tabela[r->papel].nome);
+        if (uxTaskPriorityGet(r->tarefa) != tabela[r->papel].prioridade)
+            panic("prioridades: %s fora da prioridade de %s", pcTaskGetName(r->tarefa), tabela[r->papel].nome);
+    }
+
+    printf("prioridades:");
+    for (int p = 0; p < NUM_PAPEIS; p++)
+        printf(" %s=%lu", tabela[p].nome, (unsigned long)tabela[p].prioridade);
+    printf(" (%u tasks conferidas)\n", num_registradas);
+}
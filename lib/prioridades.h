@@ -0,0 +1,71 @@
+/**
+ * @file prioridades.h
+ * @brief Tabela central de prioridades das tasks
+ *
+ * As prioridades seguem a urgência de cada papel (escala monotônica: quem
+ * tem prazo mais curto fica acima):
+ *
+ *     entradas   eventos de entrada e console: viram comandos (prazo = debounce)
+ *     controle   motor de fases, período de 10 ms
+ *     saidas     bordas do buzzer e quadros da matriz (38 ms); dentro do
+ *                executor o job do buzzer passa na frente do da matriz
+ *     barramento task do I2C: põe no fio o que os drivers enfileiram, um
+ *                pedaço por vez, e dorme esperando o DMA
+ *     display    camadas dos OLEDs (200 ms), enfileiradas no barramento
+ *     telemetria traço, perfil dos barramentos, estresse e o relatório
+ *                do comando de status
+ *
+ * A preempção não tem task: a interrupção posta o comando e acorda o
+ * controlador. Nenhuma task do firmware fica em tskIDLE_PRIORITY, então o
+ * tempo livre é só da task ociosa.
+ *
+ * Quem cria uma task usa prioridades_de() e a registra com
+ * prioridades_registrar(); prioridades_verificar(), logo antes do
+ * escalonador, confere a tabela e as tasks registradas.
+ */
+
+#ifndef PRIORIDADES_H_
+#define PRIORIDADES_H_
+
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/** @brief Tasks registradas no máximo */
+#define PRIORIDADES_MAX_TASKS 9
+
+/**
+ * @brief Papéis, do mais urgente ao menos urgente
+ */
+typedef enum
+{
+    PAPEL_ENTRADAS = 0,
+    PAPEL_CONTROLE,
+    PAPEL_SAIDAS,
+    PAPEL_BARRAMENTO,
+    PAPEL_DISPLAY,
+    PAPEL_TELEMETRIA,
+    NUM_PAPEIS,
+} PapelTask;
+
+/**
+ * @brief Prioridade do FreeRTOS de um papel
+ */
+UBaseType_t prioridades_de(PapelTask papel);
+
+/**
+ * @brief Registra uma task criada com prioridades_de(papel)
+ */
+void prioridades_registrar(PapelTask papel, TaskHandle_t tarefa);
+
+/**
+ * @brief Confere a tabela e as tasks registradas e imprime o esquema
+ *
+ * A tabela deve ser estritamente decrescente, acima de tskIDLE_PRIORITY e
+ * abaixo de configMAX_PRIORITIES; cada task registrada deve estar na
+ * prioridade do seu papel. Em caso de erro o firmware para (panic), antes
+ * de o escalonador rodar com um esquema errado.
+ */
+void prioridades_verificar(void);
+
+#endif /* PRIORIDADES_H_ */
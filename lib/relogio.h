@@ -0,0 +1,36 @@
+/**
+ * @file relogio.h
+ * @brief Fonte de tempo do firmware
+ *
+ * Controlador, buzzer, display e matriz leem o tempo apenas por aqui. No
+ * RP2040 é o timer de 64 bits do SDK; na simulação (sim/) o mesmo
+ * time_us_64() pode vir de um relógio virtual, que salta direto para o
+ * próximo prazo quando todas as tasks estão bloqueadas.
+ *
+ * O tempo em ms tem 32 bits e dá a volta em ~49,7 dias: compare sempre por
+ * diferença (agora - antes >= intervalo), nunca por "agora >= fim".
+ */
+
+#ifndef RELOGIO_H_
+#define RELOGIO_H_
+
+#include <stdint.h>
+#include "pico/stdlib.h"
+
+/**
+ * @brief Tempo desde o boot em µs (64 bits, não dá a volta)
+ */
+static inline uint64_t relogio_us(void)
+{
+    return time_us_64();
+}
+
+/**
+ * @brief Tempo desde o boot em ms (32 bits, dá a volta)
+ */
+static inline uint32_t relogio_ms(void)
+{
+    return (uint32_t)(time_us_64() / 1000u);
+}
+
+#endif /* RELOGIO_H_ */
@@ -1,5 +1,8 @@
 #include "ssd1306.h"
+#include <string.h>
 #include "font.h"
+#include "traco.h"
+#include "perfil_barramento.h"
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
   ssd->width = width;
@@ -11,61 +14,191 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->bus = NULL;
+  ssd->bus_device = -1;
+  ssd->tx_buffer = NULL;
+  ssd->errors = 0;
 }
 
-void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+void ssd1306_attach_bus(ssd1306_t *ssd, const ssd1306_bus_t *bus, int device) {
+  ssd->tx_buffer = calloc(ssd->bufsize - 1, sizeof(uint8_t));
+  ssd->bus = bus;
+  ssd->bus_device = device;
+}
+
+bool ssd1306_busy(ssd1306_t *ssd) {
+  return ssd->bus != NULL && ssd->bus->busy(ssd->bus_device);
+}
+
+// Escrita direta com prazo: um display ausente ou um barramento preso não
+// seguram quem chama. Falhas (NACK ou tempo esgotado) contam em errors.
+static bool ssd1306_write_direct(ssd1306_t *ssd, const uint8_t *data, size_t length) {
+  uint timeout = (uint)(length + 1) * SSD1306_TIMEOUT_US_PER_BYTE + SSD1306_TIMEOUT_MARGIN_US;
+  int written = i2c_write_timeout_us(ssd->i2c_port, ssd->address, data, length, false, timeout);
+  if (written == (int)length)
+    return true;
+  ssd->errors++;
+  return false;
+}
+
+// Uma escrita curta: na fila do barramento ou direto, bloqueando até o prazo
+static void ssd1306_write(ssd1306_t *ssd, const uint8_t *data, size_t length) {
+  if (ssd->bus != NULL) {
+    ssd->bus->write(ssd->bus_device, data, length);
+    return;
+  }
+  uint64_t inicio = perfil_barramento_marcar();
+  ssd1306_write_direct(ssd, data, length);
+  perfil_barramento_registrar(BARRAMENTO_I2C, length, inicio);
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->port_buffer,
-    2,
-    false
-  );
+  ssd1306_write(ssd, ssd->port_buffer, 2);
+}
+
+// Vários comandos numa só escrita (Co = 0): um byte de controle para todos
+static void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, size_t count) {
+  uint8_t buffer[16];
+  buffer[0] = 0x00;
+  memcpy(buffer + 1, commands, count);
+  ssd1306_write(ssd, buffer, count + 1);
+}
+
+// Duas listas de comandos em vez de 25 escritas: cabem na fila do barramento
+// quando o display é reconfigurado depois de uma falha
+void ssd1306_config(ssd1306_t *ssd) {
+  const uint8_t geometry[] = {
+    SET_DISP | 0x00,
+    SET_SCROLL_OFF,
+    SET_MEM_ADDR, 0x01,
+    SET_DISP_START_LINE | 0x00,
+    SET_SEG_REMAP | 0x01,
+    SET_MUX_RATIO, HEIGHT - 1,
+    SET_COM_OUT_DIR | 0x08,
+    SET_DISP_OFFSET, 0x00,
+    SET_COM_PIN_CFG, 0x12
+  };
+  const uint8_t power[] = {
+    SET_DISP_CLK_DIV, 0x80,
+    SET_PRECHARGE, 0xF1,
+    SET_VCOM_DESEL, 0x30,
+    SET_CONTRAST, 0xFF,
+    SET_ENTIRE_ON,
+    SET_NORM_INV,
+    SET_CHARGE_PUMP, 0x14,
+    SET_DISP | 0x01
+  };
+  ssd1306_command_list(ssd, geometry, sizeof(geometry));
+  ssd1306_command_list(ssd, power, sizeof(power));
+}
+
+// Desligado, o painel dorme (sem bomba de carga nem varredura) e a RAM é mantida
+void ssd1306_power(ssd1306_t *ssd, bool on) {
+  ssd1306_command(ssd, SET_DISP | (on ? 0x01 : 0x00));
+}
+
+void ssd1306_contrast(ssd1306_t *ssd, uint8_t contrast) {
+  const uint8_t commands[] = {SET_CONTRAST, contrast};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+void ssd1306_invert(ssd1306_t *ssd, bool invert) {
+  ssd1306_command(ssd, SET_NORM_INV | (invert ? 0x01 : 0x00));
+}
+
+void ssd1306_start_line(ssd1306_t *ssd, uint8_t line) {
+  ssd1306_command(ssd, SET_DISP_START_LINE | (line & 0x3F));
+}
+
+// Os parâmetros só podem mudar com a rolagem parada: o 0x2E vai sempre na frente
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_step_t step) {
+  const uint8_t commands[] = {
+    SET_SCROLL_OFF,
+    left ? SET_SCROLL_LEFT : SET_SCROLL_RIGHT, 0x00, page0, step, page1, 0x00, 0xFF,
+    SET_SCROLL_ON
+  };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_step_t step,
+                             uint8_t fixed_rows, uint8_t rows, uint8_t offset) {
+  const uint8_t commands[] = {
+    SET_SCROLL_OFF,
+    SET_VERT_SCROLL_AREA, fixed_rows, rows,
+    left ? SET_SCROLL_VERT_LEFT : SET_SCROLL_VERT_RIGHT, 0x00, page0, step, page1, offset,
+    SET_SCROLL_ON
+  };
+  ssd1306_command_list(ssd, commands, sizeof(commands));
+}
+
+void ssd1306_scroll_stop(ssd1306_t *ssd) {
+  ssd1306_command(ssd, SET_SCROLL_OFF);
+}
+
+static void ssd1306_set_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  const uint8_t commands[] = {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1};
+  ssd1306_command_list(ssd, commands, sizeof(commands));
 }
 
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
-    ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
-  );
+  ssd1306_set_window(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+  if (ssd->bus != NULL) {
+    // O ram_buffer pode mudar enquanto a tela está na fila
+    memcpy(ssd->tx_buffer, ssd->ram_buffer + 1, ssd->bufsize - 1);
+    ssd->bus->write_chunks(ssd->bus_device, 0x40, ssd->tx_buffer, ssd->bufsize - 1);
+  } else {
+    uint64_t inicio = perfil_barramento_marcar();
+    ssd1306_write_direct(ssd, ssd->ram_buffer, ssd->bufsize);
+    perfil_barramento_registrar(BARRAMENTO_I2C, ssd->bufsize, inicio);
+  }
+  traco_registrar(TRACO_OLED, traco_hash(ssd->ram_buffer, ssd->bufsize));
+}
+
+void ssd1306_send_region(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  ssd1306_set_window(ssd, x0, x1, page0, page1);
+  uint8_t pages = page1 - page0 + 1;
+
+  if (ssd->bus != NULL) {
+    // Com o endereçamento vertical a janela chega coluna a coluna: junta as
+    // páginas de cada coluna e deixa o resto para o barramento, que a
+    // divide em pedaços com o byte de controle 0x40
+    uint8_t *byte = ssd->tx_buffer;
+    for (uint8_t x = x0; x <= x1; ++x) {
+      memcpy(byte, ssd->ram_buffer + 1 + x * ssd->pages + page0, pages);
+      byte += pages;
+    }
+    ssd->bus->write_chunks(ssd->bus_device, 0x40, ssd->tx_buffer, byte - ssd->tx_buffer);
+  } else {
+    // Sem barramento, uma escrita por coluna: o display continua do ponto em
+    // que parou. Depois de uma falha o resto da janela não adianta.
+    uint8_t column[1 + 8];
+    column[0] = 0x40;
+    uint64_t inicio = perfil_barramento_marcar();
+    size_t sent = 0;
+    for (uint8_t x = x0; x <= x1; ++x) {
+      memcpy(column + 1, ssd->ram_buffer + 1 + x * ssd->pages + page0, pages);
+      sent += 1 + pages;
+      if (!ssd1306_write_direct(ssd, column, 1 + pages))
+        break;
+    }
+    perfil_barramento_registrar(BARRAMENTO_I2C, sent, inicio);
+  }
+
+  traco_registrar(TRACO_OLED, traco_hash(ssd->ram_buffer, ssd->bufsize));
+}
+
+void ssd1306_send_frame_dma(ssd1306_t *ssd, const uint16_t *words) {
+  ssd1306_set_window(ssd, 0, ssd->width - 1, 0, ssd->pages - 1);
+  ssd->bus->write_words(ssd->bus_device, words, ssd->bufsize);
+#if TRACO_HABILITADO
+  uint32_t hash = TRACO_HASH_INICIAL;
+  for (size_t i = 0; i < ssd->bufsize; i++) {
+    uint8_t byte = (uint8_t)words[i];
+    hash = traco_hash_continuar(hash, &byte, 1);
+  }
+  traco_registrar(TRACO_OLED, hash);
+#endif
 }
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
@@ -153,8 +286,8 @@ void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value
     ssd1306_pixel(ssd, x, y, value);
 }
 
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+// Colunas de um caractere na fonte 8x8
+const uint8_t *ssd1306_glyph(char c)
 {
   uint16_t index = 0;
 
@@ -168,11 +301,18 @@ void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
     // Caractere inválido, desenha um espaço (ou pode ser tratado de outra forma)
     index = 0; // Índice 0 corresponde ao caractere "nada" (espaço)
   }
+  return &font[index];
+}
+
+// Função para desenhar um caractere
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  const uint8_t *glyph = ssd1306_glyph(c);
 
   // Desenha o caractere na tela
   for (uint8_t i = 0; i < 8; ++i)
   {
-    uint8_t line = font[index + i]; // Acessa a linha correspondente do caractere na fonte
+    uint8_t line = glyph[i]; // Acessa a linha correspondente do caractere na fonte
     for (uint8_t j = 0; j < 8; ++j)
     {
       ssd1306_pixel(ssd, x + i, y + j, line & (1 << j)); // Desenha cada pixel do caractere
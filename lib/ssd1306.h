@@ -1,3 +1,6 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
@@ -22,9 +25,46 @@ typedef enum {
   SET_DISP_CLK_DIV = 0xD5,
   SET_PRECHARGE = 0xD9,
   SET_VCOM_DESEL = 0xDB,
-  SET_CHARGE_PUMP = 0x8D
+  SET_CHARGE_PUMP = 0x8D,
+  SET_SCROLL_RIGHT = 0x26,
+  SET_SCROLL_LEFT = 0x27,
+  SET_SCROLL_VERT_RIGHT = 0x29,
+  SET_SCROLL_VERT_LEFT = 0x2A,
+  SET_SCROLL_OFF = 0x2E,
+  SET_SCROLL_ON = 0x2F,
+  SET_VERT_SCROLL_AREA = 0xA3
 } ssd1306_command_t;
 
+// Intervalo entre dois passos de rolagem, em quadros do painel (~100 Hz)
+typedef enum {
+  SSD1306_SCROLL_2_FRAMES = 0x07,
+  SSD1306_SCROLL_3_FRAMES = 0x04,
+  SSD1306_SCROLL_4_FRAMES = 0x05,
+  SSD1306_SCROLL_5_FRAMES = 0x00,
+  SSD1306_SCROLL_25_FRAMES = 0x06,
+  SSD1306_SCROLL_64_FRAMES = 0x01,
+  SSD1306_SCROLL_128_FRAMES = 0x02,
+  SSD1306_SCROLL_256_FRAMES = 0x03
+} ssd1306_scroll_step_t;
+
+// Prazo das escritas diretas: 200 us por byte cobre 9 bits a 100 kHz com
+// clock stretching; a margem cobre o início da transação
+#define SSD1306_TIMEOUT_US_PER_BYTE 200
+#define SSD1306_TIMEOUT_MARGIN_US 2000
+
+// Fila de um gerenciador de barramento (lib/barramento_i2c.h), em vez de
+// i2c_write_blocking(): as escritas entram na fila do dispositivo e voltam
+// sem esperar. Quem liga os dois monta a tabela com as funções do gerenciador.
+typedef struct {
+  // Escrita curta (até 16 bytes), copiada
+  bool (*write)(int device, const uint8_t *data, size_t length);
+  // Escrita longa em pedaços que começam com prefix; data fica intacto até !busy
+  bool (*write_chunks)(int device, uint8_t prefix, const uint8_t *data, size_t length);
+  // Palavras prontas do IC_DATA_CMD (STOP na última), sem cópia
+  bool (*write_words)(int device, const uint16_t *words, size_t count);
+  bool (*busy)(int device);
+} ssd1306_bus_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
   i2c_inst_t *i2c_port;
@@ -32,19 +72,56 @@ typedef struct {
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  const ssd1306_bus_t *bus; // NULL até ssd1306_attach_bus(): escritas bloqueantes
+  int bus_device;
+  uint8_t *tx_buffer; // Janela de ssd1306_send_region() enquanto está na fila
+  uint32_t errors;    // Escritas diretas perdidas (NACK ou tempo esgotado)
 } ssd1306_t;
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+// Também serve para reconfigurar um display que reiniciou (rolagem parada,
+// contraste máximo, tela normal, linha inicial 0); a RAM fica como estava
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_power(ssd1306_t *ssd, bool on);
+void ssd1306_contrast(ssd1306_t *ssd, uint8_t contrast);
+// Inverte aceso/apagado na tela inteira, sem mexer na RAM
+void ssd1306_invert(ssd1306_t *ssd, bool invert);
+// Primeira linha da RAM mostrada no alto (0-63): desloca a tela na vertical, com volta
+void ssd1306_start_line(ssd1306_t *ssd, uint8_t line);
+// Rolagem contínua feita pelo painel nas páginas page0..page1, com volta.
+// Enquanto ela está ligada a RAM não pode ser escrita; depois de
+// ssd1306_scroll_stop() a região rolada precisa ser reenviada.
+void ssd1306_scroll_horizontal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_step_t step);
+// Rolagem vertical (offset linhas por passo) das linhas fixed_rows..fixed_rows+rows-1,
+// junto com a horizontal das páginas page0..page1
+void ssd1306_scroll_diagonal(ssd1306_t *ssd, bool left, uint8_t page0, uint8_t page1, ssd1306_scroll_step_t step,
+                             uint8_t fixed_rows, uint8_t rows, uint8_t offset);
+void ssd1306_scroll_stop(ssd1306_t *ssd);
 void ssd1306_send_data(ssd1306_t *ssd);
 
+// Daqui em diante comandos e dados vão pela fila do dispositivo no barramento
+// e nenhuma função espera o fio
+void ssd1306_attach_bus(ssd1306_t *ssd, const ssd1306_bus_t *bus, int device);
+// Quadro inteiro direto da flash para o I2C, sem passar pelo ram_buffer (só
+// com barramento). words: bufsize palavras prontas para o IC_DATA_CMD (0x40,
+// os bytes da tela na ordem do ram_buffer, STOP no último), como as de lib/assets.h
+void ssd1306_send_frame_dma(ssd1306_t *ssd, const uint16_t *words);
+// Há escritas do display na fila do barramento
+bool ssd1306_busy(ssd1306_t *ssd);
+// Envia só as colunas x0..x1 das páginas page0..page1 do ram_buffer (limites
+// inclusivos). Com barramento a janela é copiada e a função não bloqueia.
+void ssd1306_send_region(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
+const uint8_t *ssd1306_glyph(char c);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
-void ssd1306_draw_bitmap(ssd1306_t *ssd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t width, uint8_t height);
\ No newline at end of file
+void ssd1306_draw_bitmap(ssd1306_t *ssd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t width, uint8_t height);
+
+#endif // SSD1306_H
@@ -0,0 +1,115 @@
+/**
+ * @file traco.c
+ * @brief Implementação do traço das saídas
+ */
+
+#include "traco.h"
+
+#if TRACO_HABILITADO
+
+#include "relogio.h"
+#include "hardware/sync.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "prioridades.h"
+#include <stdio.h>
+
+#define TRACO_PERIODO_MS 20 // Intervalo entre esvaziamentos do anel
+
+typedef struct
+{
+    uint64_t tempo_us;
+    uint32_t valor;
+    uint8_t saida;
+} EventoTraco;
+
+static const char *const nomes_saida[] = {"led", "buzzer", "oled", "matriz"};
+
+static EventoTraco anel[TRACO_TAMANHO_ANEL];
+static uint32_t escritos = 0; // Índices livres: a posição é o resto por TRACO_TAMANHO_ANEL
+static uint32_t lidos = 0;
+static uint32_t perdidos = 0;
+
+void traco_registrar(SaidaTraco saida, uint32_t valor)
+{
+    uint64_t agora = relogio_us();
+    uint32_t estado = save_and_disable_interrupts();
+
+    if (escritos - lidos < TRACO_TAMANHO_ANEL)
+    {
+        anel[escritos % TRACO_TAMANHO_ANEL] = (EventoTraco){agora, valor, (uint8_t)saida};
+        escritos++;
+    }
+    else
+        perdidos++;
+
+    restore_interrupts(estado);
+}
+
+uint32_t traco_hash(const void *dados, size_t tamanho)
+{
+    return traco_hash_continuar(TRACO_HASH_INICIAL, dados, tamanho);
+}
+
+uint32_t traco_hash_continuar(uint32_t hash, const void *dados, size_t tamanho)
+{
+    const uint8_t *p = dados;
+    for (size_t i = 0; i < tamanho; i++)
+    {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Retira o evento mais antigo do anel
+ *
+ * @param perdas Recebe os eventos descartados desde a última retirada
+ * @return false se o anel está vazio
+ */
+static bool retirar(EventoTraco *evento, uint32_t *perdas)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    bool tem = lidos != escritos;
+    if (tem)
+        *evento = anel[lidos++ % TRACO_TAMANHO_ANEL];
+    *perdas = perdidos;
+    perdidos = 0;
+    restore_interrupts(estado);
+    return tem;
+}
+
+/**
+ * @brief Task que imprime o traço, fora do caminho das saídas
+ */
+static void tarefa_traco(void *parametro)
+{
+    (void)parametro;
+    EventoTraco evento;
+    uint32_t perdas;
+
+    while (true)
+    {
+        while (true)
+        {
+            bool tem = retirar(&evento, &perdas);
+            if (perdas)
+                printf("@T %llu perda %lx\n", (unsigned long long)relogio_us(), (unsigned long)perdas);
+            if (!tem)
+                break;
+            printf("@T %llu %s %06lx\n", (unsigned long long)evento.tempo_us, nomes_saida[evento.saida],
+                   (unsigned long)evento.valor);
+        }
+        vTaskDelay(pdMS_TO_TICKS(TRACO_PERIODO_MS));
+    }
+}
+
+void traco_iniciar(void)
+{
+    TaskHandle_t tarefa = NULL;
+    xTaskCreate(tarefa_traco, "Traco", configMINIMAL_STACK_SIZE, NULL, prioridades_de(PAPEL_TELEMETRIA), &tarefa);
+    prioridades_registrar(PAPEL_TELEMETRIA, tarefa);
+}
+
+#endif
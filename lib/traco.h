@@ -0,0 +1,104 @@
+/**
+ * @file traco.h
+ * @brief Traço das saídas (LED RGB, buzzer, OLED e matriz) para comparação
+ *
+ * Cada evento vira uma linha no stdio (USB no RP2040, stdout na simulação):
+ *
+ *     @T <tempo_us> <saida> <valor hexadecimal>
+ *
+ * - led: cor do LED RGB (0xRRGGBB)
+ * - buzzer: 0 = desligado, 1 + id do sinal sonoro (AudioCueId)
+ * - oled: hash do framebuffer depois de ssd1306_send_data()
+ * - matriz: hash do buffer de LEDs depois de npWrite()
+ * - perda: número de eventos descartados com o anel cheio
+ *
+ * O prefixo "@T" separa o traço das demais mensagens do firmware. Dois
+ * traços (da placa ou da simulação) são comparados com
+ * sim/ferramentas/comparar_tracos.c.
+ *
+ * Os eventos vão para um anel e uma task de baixa prioridade os imprime, então
+ * registrar custa poucos µs em qualquer contexto. O traço só é compilado com
+ * TRACO_HABILITADO=1 (opção SEMAFORO_TRACO do CMake); sem ela as chamadas
+ * somem do binário.
+ */
+
+#ifndef TRACO_H_
+#define TRACO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef TRACO_HABILITADO
+#define TRACO_HABILITADO 0
+#endif
+
+/** @brief Eventos guardados até a task de traço imprimi-los */
+#define TRACO_TAMANHO_ANEL 256
+
+typedef enum
+{
+    TRACO_LED = 0,
+    TRACO_BUZZER = 1,
+    TRACO_OLED = 2,
+    TRACO_MATRIZ = 3,
+} SaidaTraco;
+
+#if TRACO_HABILITADO
+
+/**
+ * @brief Cria a task que imprime o traço
+ *
+ * Deve ser chamada antes de vTaskStartScheduler(). Eventos registrados
+ * antes disso ficam no anel.
+ */
+void traco_iniciar(void);
+
+/**
+ * @brief Registra um evento de saída com o tempo atual
+ *
+ * Pode ser chamada de tasks e interrupções.
+ */
+void traco_registrar(SaidaTraco saida, uint32_t valor);
+
+/**
+ * @brief Hash FNV-1a de 32 bits de um buffer de saída
+ */
+uint32_t traco_hash(const void *dados, size_t tamanho);
+
+/** @brief Valor inicial do hash, para traco_hash_continuar() */
+#define TRACO_HASH_INICIAL 2166136261u
+
+/**
+ * @brief Continua um hash com mais bytes (saídas que não estão num buffer só)
+ */
+uint32_t traco_hash_continuar(uint32_t hash, const void *dados, size_t tamanho);
+
+#else
+
+static inline void traco_iniciar(void)
+{
+}
+
+static inline void traco_registrar(SaidaTraco saida, uint32_t valor)
+{
+    (void)saida;
+    (void)valor;
+}
+
+static inline uint32_t traco_hash(const void *dados, size_t tamanho)
+{
+    (void)dados;
+    (void)tamanho;
+    return 0;
+}
+
+static inline uint32_t traco_hash_continuar(uint32_t hash, const void *dados, size_t tamanho)
+{
+    (void)dados;
+    (void)tamanho;
+    return hash;
+}
+
+#endif
+
+#endif /* TRACO_H_ */
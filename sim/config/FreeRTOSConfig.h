@@ -0,0 +1,155 @@
+/*
+ * FreeRTOS V202107.00
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+ #ifndef FREERTOS_CONFIG_H
+ #define FREERTOS_CONFIG_H
+ 
+ /*-----------------------------------------------------------
+  * Configuração da simulação em Linux (port POSIX do FreeRTOS).
+  *
+  * Igual a lib/FreeRTOSConfig.h, exceto pelas pilhas maiores (threads do
+  * Linux), pela ausência das opções específicas do RP2040 e pelos ganchos
+  * do relógio virtual (tickless idle, idle hook e troca de task, ver
+  * hal/tempo.c).
+  *
+  * Application specific definitions.
+  *
+  * These definitions should be adjusted for your particular hardware and
+  * application requirements.
+  *
+  * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+  * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+  *
+  * See http://www.freertos.org/a00110.html
+  *----------------------------------------------------------*/
+ 
+ /* Scheduler Related */
+ #define configUSE_PREEMPTION                    1
+ #define configUSE_TICKLESS_IDLE                 1
+ #define configUSE_IDLE_HOOK                     1
+ #define configUSE_TICK_HOOK                     0
+ #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
+ #define configMAX_PRIORITIES                    32
+ /* Port POSIX: cada task é uma thread e a pilha precisa de PTHREAD_STACK_MIN */
+ #define configMINIMAL_STACK_SIZE                ( configSTACK_DEPTH_TYPE ) 4096
+ #define configUSE_16_BIT_TICKS                  0
+ 
+ #define configIDLE_SHOULD_YIELD                 1
+ 
+ /* Synchronization Related */
+ #define configUSE_MUTEXES                       1
+ #define configUSE_RECURSIVE_MUTEXES             1
+ #define configUSE_APPLICATION_TASK_TAG          0
+ #define configUSE_COUNTING_SEMAPHORES           1
+ #define configQUEUE_REGISTRY_SIZE               8
+ #define configUSE_QUEUE_SETS                    1
+ #define configUSE_TIME_SLICING                  1
+ #define configUSE_NEWLIB_REENTRANT              0
+ #define configENABLE_BACKWARD_COMPATIBILITY     0
+ #define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+ 
+ /* System */
+ #define configSTACK_DEPTH_TYPE                  uint32_t
+ #define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
+ 
+ /* Memory allocation related definitions. */
+ #define configSUPPORT_STATIC_ALLOCATION         0
+ #define configSUPPORT_DYNAMIC_ALLOCATION        1
+ #define configTOTAL_HEAP_SIZE                   (4*1024*1024)
+ #define configAPPLICATION_ALLOCATED_HEAP        0
+ 
+ /* Hook function related definitions. */
+ #define configCHECK_FOR_STACK_OVERFLOW          0
+ #define configUSE_MALLOC_FAILED_HOOK            0
+ #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
+ 
+ /* Run time and task stats gathering related definitions. */
+ #define configGENERATE_RUN_TIME_STATS           0
+ #define configUSE_TRACE_FACILITY                1
+ #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+ 
+ /* Co-routine related definitions. */
+ #define configUSE_CO_ROUTINES                   0
+ #define configMAX_CO_ROUTINE_PRIORITIES         1
+ 
+ /* Software timer related definitions. */
+ #define configUSE_TIMERS                        1
+ #define configTIMER_TASK_PRIORITY               ( configMAX_PRIORITIES - 1 )
+ #define configTIMER_QUEUE_LENGTH                10
+ #define configTIMER_TASK_STACK_DEPTH            1024
+ 
+ /* Interrupt nesting behaviour configuration. */
+ /*
+ #define configKERNEL_INTERRUPT_PRIORITY         [dependent of processor]
+ #define configMAX_SYSCALL_INTERRUPT_PRIORITY    [dependent on processor and application]
+ #define configMAX_API_CALL_INTERRUPT_PRIORITY   [dependent on processor and application]
+ */
+ 
+ #include <assert.h>
+ /* Define to trap errors during development. */
+ #define configASSERT(x)                         assert(x)
+ 
+ /* Set the following definitions to 1 to include the API function, or zero
+ to exclude the API function. */
+ #define INCLUDE_vTaskPrioritySet                1
+ #define INCLUDE_uxTaskPriorityGet               1
+ #define INCLUDE_vTaskDelete                     1
+ #define INCLUDE_vTaskSuspend                    1
+ #define INCLUDE_vTaskDelayUntil                 1
+ #define INCLUDE_vTaskDelay                      1
+ #define INCLUDE_xTaskGetSchedulerState          1
+ #define INCLUDE_xTaskGetCurrentTaskHandle       1
+ #define INCLUDE_uxTaskGetStackHighWaterMark     1
+ #define INCLUDE_xTaskGetIdleTaskHandle          1
+ #define INCLUDE_eTaskGetState                   1
+ #define INCLUDE_xTimerPendFunctionCall          1
+ #define INCLUDE_xTaskAbortDelay                 1
+ #define INCLUDE_xTaskGetHandle                  1
+ #define INCLUDE_xTaskResumeFromISR              1
+ #define INCLUDE_xQueueGetMutexHolder            1
+ 
+ /* A header file that defines trace macro can be included here. */
+ 
+ /* Relógio virtual: o idle salta o tick até o próximo prazo (hal/tempo.c);
+  * o salto faz o papel do WFI e é medido pelos mesmos ganchos (lib/energia.c) */
+ #include <stdint.h>
+ void sim_relogio_saltar( uint32_t ticks );
+ void sim_relogio_tarefa_entrou( void );
+ void energia_antes_de_dormir( void );
+ void energia_depois_de_dormir( void );
+ #define configPRE_SLEEP_PROCESSING( xExpectedIdleTime )     energia_antes_de_dormir()
+ #define configPOST_SLEEP_PROCESSING( xExpectedIdleTime )    energia_depois_de_dormir()
+ #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )              \
+     do                                                                 \
+     {                                                                  \
+         configPRE_SLEEP_PROCESSING( xExpectedIdleTime );               \
+         sim_relogio_saltar( xExpectedIdleTime );                       \
+         configPOST_SLEEP_PROCESSING( xExpectedIdleTime );              \
+     } while( 0 )
+ #define traceTASK_SWITCHED_IN()                              sim_relogio_tarefa_entrou()
+ 
+ #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
@@ -0,0 +1,251 @@
+/**
+ * @file comparar_tracos.c
+ * @brief Compara dois traços de saídas (lib/traco.h) e aponta a primeira divergência
+ *
+ * Uso: comparar_tracos [-t tolerancia_ms] [-b] referencia.txt novo.txt
+ *
+ * Os arquivos podem ser a captura da USB da placa, o stdout da simulação ou
+ * o perifericos.log: só as linhas com "@T" contam. Os tempos são relativos
+ * ao primeiro evento de cada traço.
+ *
+ * Cada saída (led, buzzer, oled, matriz) é comparada em separado, evento a
+ * evento: valores iguais e tempos dentro da tolerância (padrão 50 ms). Por
+ * padrão, escritas repetidas do mesmo valor contam uma vez só, já que não
+ * mudam a saída física; -b compara todas as escritas. Eventos depois do fim
+ * do traço mais curto (menos a tolerância) não são comparados.
+ *
+ * Saída: 0 = equivalentes, 1 = divergem, 2 = erro (arquivo, uso ou traço
+ * com eventos perdidos).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_SAIDAS 4
+#define TOLERANCIA_PADRAO_MS 50
+
+static const char *const nomes_saida[NUM_SAIDAS] = {"led", "buzzer", "oled", "matriz"};
+
+typedef struct
+{
+    uint64_t tempo_us;
+    uint32_t valor;
+} Evento;
+
+typedef struct
+{
+    Evento *eventos;
+    size_t quantidade;
+    size_t capacidade;
+} ListaEventos;
+
+typedef struct
+{
+    const char *caminho;
+    ListaEventos saidas[NUM_SAIDAS];
+    uint64_t fim_us; // Último evento, relativo ao primeiro
+} Traco;
+
+static void acrescentar(ListaEventos *lista, Evento evento)
+{
+    if (lista->quantidade == lista->capacidade)
+    {
+        lista->capacidade = lista->capacidade ? lista->capacidade * 2 : 1024;
+        lista->eventos = realloc(lista->eventos, lista->capacidade * sizeof(Evento));
+        if (lista->eventos == NULL)
+        {
+            fprintf(stderr, "comparar_tracos: memoria insuficiente\n");
+            exit(2);
+        }
+    }
+    lista->eventos[lista->quantidade++] = evento;
+}
+
+static int indice_saida(const char *nome)
+{
+    for (int i = 0; i < NUM_SAIDAS; i++)
+    {
+        if (strcmp(nome, nomes_saida[i]) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Lê as linhas "@T" de um arquivo
+ *
+ * @param brutas false para descartar escritas que repetem o valor anterior
+ */
+static void ler_traco(Traco *traco, const char *caminho, bool brutas)
+{
+    FILE *f = fopen(caminho, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "comparar_tracos: nao foi possivel abrir %s\n", caminho);
+        exit(2);
+    }
+
+    memset(traco, 0, sizeof(*traco));
+    traco->caminho = caminho;
+
+    char linha[512];
+    bool primeiro = true;
+    uint64_t inicio_us = 0;
+    while (fgets(linha, sizeof(linha), f) != NULL)
+    {
+        const char *marca = strstr(linha, "@T ");
+        if (marca == NULL)
+            continue;
+
+        unsigned long long tempo;
+        char nome[16];
+        unsigned long valor;
+        if (sscanf(marca, "@T %llu %15s %lx", &tempo, nome, &valor) != 3)
+            continue;
+
+        if (strcmp(nome, "perda") == 0)
+        {
+            fprintf(stderr, "comparar_tracos: %s perdeu %lu eventos em %llu us\n", caminho, valor, tempo);
+            exit(2);
+        }
+
+        int s = indice_saida(nome);
+        if (s < 0)
+            continue;
+
+        if (primeiro)
+        {
+            inicio_us = tempo;
+            primeiro = false;
+        }
+        uint64_t relativo = (tempo > inicio_us) ? tempo - inicio_us : 0;
+        if (relativo > traco->fim_us)
+            traco->fim_us = relativo;
+
+        ListaEventos *lista = &traco->saidas[s];
+        if (!brutas && lista->quantidade > 0 && lista->eventos[lista->quantidade - 1].valor == valor)
+            continue;
+        acrescentar(lista, (Evento){relativo, (uint32_t)valor});
+    }
+    fclose(f);
+}
+
+typedef struct
+{
+    bool encontrada;
+    uint64_t tempo_us; // Para escolher a divergência mais cedo entre as saídas
+    int saida;
+    size_t indice;
+    const Evento *referencia; // NULL se o traço de referência acabou antes
+    const Evento *novo;
+} Divergencia;
+
+static uint64_t diferenca(uint64_t a, uint64_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+/**
+ * @brief Primeira divergência de uma saída até o horizonte comparável
+ */
+static Divergencia comparar_saida(const ListaEventos *a, const ListaEventos *b, int saida, uint64_t tolerancia_us,
+                                  uint64_t horizonte_us)
+{
+    Divergencia d = {.saida = saida};
+    size_t n = (a->quantidade > b->quantidade) ? a->quantidade : b->quantidade;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const Evento *ea = (i < a->quantidade) ? &a->eventos[i] : NULL;
+        const Evento *eb = (i < b->quantidade) ? &b->eventos[i] : NULL;
+
+        // Fim do trecho comparável: eventos a partir daqui podem só não ter sido capturados
+        if ((ea == NULL || ea->tempo_us > horizonte_us) && (eb == NULL || eb->tempo_us > horizonte_us))
+            break;
+
+        bool igual = ea != NULL && eb != NULL && ea->valor == eb->valor &&
+                     diferenca(ea->tempo_us, eb->tempo_us) <= tolerancia_us;
+        if (!igual)
+        {
+            d.encontrada = true;
+            d.indice = i;
+            d.referencia = ea;
+            d.novo = eb;
+            d.tempo_us = (ea && eb) ? (ea->tempo_us < eb->tempo_us ? ea->tempo_us : eb->tempo_us)
+                                    : (ea ? ea->tempo_us : eb->tempo_us);
+            break;
+        }
+    }
+    return d;
+}
+
+static void imprimir_evento(const char *rotulo, const Evento *e)
+{
+    if (e == NULL)
+        printf("  %-10s (sem evento)\n", rotulo);
+    else
+        printf("  %-10s %06lx em %llu.%03llu ms\n", rotulo, (unsigned long)e->valor,
+               (unsigned long long)(e->tempo_us / 1000u), (unsigned long long)(e->tempo_us % 1000u));
+}
+
+static void uso(void)
+{
+    fprintf(stderr, "uso: comparar_tracos [-t tolerancia_ms] [-b] referencia.txt novo.txt\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t tolerancia_us = (uint64_t)TOLERANCIA_PADRAO_MS * 1000u;
+    bool brutas = false;
+    const char *caminhos[2];
+    int num_caminhos = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            tolerancia_us = strtoull(argv[++i], NULL, 10) * 1000u;
+        else if (strcmp(argv[i], "-b") == 0)
+            brutas = true;
+        else if (argv[i][0] != '-' && num_caminhos < 2)
+            caminhos[num_caminhos++] = argv[i];
+        else
+            uso();
+    }
+    if (num_caminhos != 2)
+        uso();
+
+    static Traco referencia, novo;
+    ler_traco(&referencia, caminhos[0], brutas);
+    ler_traco(&novo, caminhos[1], brutas);
+
+    uint64_t fim = (referencia.fim_us < novo.fim_us) ? referencia.fim_us : novo.fim_us;
+    uint64_t horizonte = (fim > tolerancia_us) ? fim - tolerancia_us : 0;
+
+    Divergencia primeira = {0};
+    for (int s = 0; s < NUM_SAIDAS; s++)
+    {
+        Divergencia d = comparar_saida(&referencia.saidas[s], &novo.saidas[s], s, tolerancia_us, horizonte);
+        if (d.encontrada && (!primeira.encontrada || d.tempo_us < primeira.tempo_us))
+            primeira = d;
+    }
+
+    if (primeira.encontrada)
+    {
+        printf("divergencia em %s, evento %zu (%llu ms):\n", nomes_saida[primeira.saida], primeira.indice,
+               (unsigned long long)(primeira.tempo_us / 1000u));
+        imprimir_evento("referencia", primeira.referencia);
+        imprimir_evento("novo", primeira.novo);
+        return 1;
+    }
+
+    printf("tracos equivalentes ate %llu ms (tolerancia %llu ms):", (unsigned long long)(horizonte / 1000u),
+           (unsigned long long)(tolerancia_us / 1000u));
+    for (int s = 0; s < NUM_SAIDAS; s++)
+        printf(" %s=%zu", nomes_saida[s], referencia.saidas[s].quantidade);
+    printf("\n");
+    return 0;
+}
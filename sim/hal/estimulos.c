@@ -0,0 +1,154 @@
+/**
+ * @file estimulos.c
+ * @brief Roteiro de estímulos externos da simulação
+ *
+ * Uma linha por evento, em ordem crescente de tempo ('#' inicia comentário),
+ * com o tempo contado do início do relógio da simulação:
+ *
+ *     <ms> gpio <pino> <0|1|solto>   nível imposto no pino (botões, contatos)
+ *     <ms> adc <canal> <valor>       valor de 12 bits do canal do ADC
+ *     <ms> console <texto>           linha digitada no console serial
+ *     <ms> i2c <endereco> <ok|nack|preso>
+ *                                    falha de um dispositivo I2C (endereço
+ *                                    como 0x3c); preso vale para a próxima
+ *                                    transferência (ver sim.h)
+ */
+
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ESTIMULOS 1024
+#define TAMANHO_TEXTO 40
+
+typedef enum
+{
+    ESTIMULO_GPIO,
+    ESTIMULO_ADC,
+    ESTIMULO_CONSOLE,
+    ESTIMULO_I2C,
+} TipoEstimulo;
+
+typedef struct
+{
+    uint64_t instante_us;
+    TipoEstimulo tipo;
+    unsigned alvo;
+    int valor;
+    char texto[TAMANHO_TEXTO]; // ESTIMULO_CONSOLE
+} Estimulo;
+
+static Estimulo estimulos[MAX_ESTIMULOS];
+static size_t num_estimulos = 0;
+static size_t proximo = 0;
+
+void sim_estimulos_carregar(const char *caminho)
+{
+    FILE *f = fopen(caminho, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "sim: nao foi possivel abrir %s\n", caminho);
+        exit(1);
+    }
+
+    char linha[128];
+    unsigned numero = 0;
+    while (fgets(linha, sizeof(linha), f) != NULL)
+    {
+        numero++;
+        char *comentario = strchr(linha, '#');
+        if (comentario)
+            *comentario = '\0';
+
+        unsigned long long ms;
+        char tipo[8], valor[8];
+        int alvo = 0; // %i: endereços I2C em hexadecimal
+        int resto = 0;
+        int campos = sscanf(linha, "%llu %7s %n%i %7s", &ms, tipo, &resto, &alvo, valor);
+        if (campos <= 0)
+            continue;
+        bool console = campos >= 2 && strcmp(tipo, "console") == 0;
+        if ((!console && campos != 4) || num_estimulos >= MAX_ESTIMULOS)
+        {
+            fprintf(stderr, "sim: %s:%u: estimulo invalido\n", caminho, numero);
+            exit(1);
+        }
+
+        Estimulo *e = &estimulos[num_estimulos];
+        e->instante_us = sim_relogio_inicio_us() + ms * 1000u;
+        e->alvo = (unsigned)alvo;
+        if (console)
+        {
+            // O texto vai até o fim da linha (ou do comentário), sem espaços nas pontas
+            e->tipo = ESTIMULO_CONSOLE;
+            char *texto = linha + resto;
+            size_t n = strcspn(texto, "\r\n");
+            while (n > 0 && texto[n - 1] == ' ')
+                n--;
+            if (n >= TAMANHO_TEXTO)
+                n = TAMANHO_TEXTO - 1;
+            memcpy(e->texto, texto, n);
+            e->texto[n] = '\0';
+        }
+        else if (strcmp(tipo, "gpio") == 0)
+        {
+            e->tipo = ESTIMULO_GPIO;
+            e->valor = (strcmp(valor, "solto") == 0) ? -1 : atoi(valor) != 0;
+        }
+        else if (strcmp(tipo, "adc") == 0)
+        {
+            e->tipo = ESTIMULO_ADC;
+            e->valor = atoi(valor);
+        }
+        else if (strcmp(tipo, "i2c") == 0)
+        {
+            e->tipo = ESTIMULO_I2C;
+            if (strcmp(valor, "nack") == 0)
+                e->valor = SIM_I2C_NACK;
+            else if (strcmp(valor, "preso") == 0)
+                e->valor = SIM_I2C_PRESO;
+            else if (strcmp(valor, "ok") == 0)
+                e->valor = SIM_I2C_OK;
+            else
+            {
+                fprintf(stderr, "sim: %s:%u: falha i2c desconhecida '%s'\n", caminho, numero, valor);
+                exit(1);
+            }
+        }
+        else
+        {
+            fprintf(stderr, "sim: %s:%u: tipo desconhecido '%s'\n", caminho, numero, tipo);
+            exit(1);
+        }
+
+        if (num_estimulos > 0 && e->instante_us < estimulos[num_estimulos - 1].instante_us)
+        {
+            fprintf(stderr, "sim: %s:%u: estimulos fora de ordem\n", caminho, numero);
+            exit(1);
+        }
+        num_estimulos++;
+    }
+    fclose(f);
+}
+
+void sim_estimulos_atender(uint64_t agora_us)
+{
+    while (proximo < num_estimulos && estimulos[proximo].instante_us <= agora_us)
+    {
+        const Estimulo *e = &estimulos[proximo++];
+        if (e->tipo == ESTIMULO_GPIO)
+            sim_gpio_nivel_externo(e->alvo, e->valor);
+        else if (e->tipo == ESTIMULO_CONSOLE)
+            sim_console_entrada(e->texto);
+        else if (e->tipo == ESTIMULO_I2C)
+            sim_i2c_definir_falha(e->alvo, (SimFalhaI2C)e->valor);
+        else
+            sim_adc_definir(e->alvo, (uint16_t)e->valor);
+    }
+}
+
+uint64_t sim_estimulos_proximo_us(void)
+{
+    return (proximo < num_estimulos) ? estimulos[proximo].instante_us : UINT64_MAX;
+}
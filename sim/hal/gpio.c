@@ -0,0 +1,239 @@
+/**
+ * @file gpio.c
+ * @brief GPIO da simulação: níveis, pulls, bordas e despacho de interrupções
+ *
+ * O nível lido de um pino é, em ordem: o valor de saída (se for saída), o
+ * nível imposto pelos estímulos, ou o pull configurado. Bordas ficam
+ * registradas como no INTR do RP2040 e são despachadas pela task de
+ * interrupções enquanto estiverem habilitadas e não reconhecidas.
+ *
+ * Bordas de descida também vão para a simulação do I2C: um escravo preso
+ * (estímulo "i2c ... preso") solta o SDA depois de pulsos no SCL.
+ */
+
+#include "sim.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+
+#define MAX_HANDLERS_RAW 8
+
+typedef struct
+{
+    enum gpio_function funcao;
+    bool saida;
+    bool valor;        // Valor de saída
+    int8_t externo;    // Nível imposto de fora (-1 = desconectado)
+    int8_t pull;       // 1 = pull-up, 0 = pull-down, -1 = sem pull
+    bool ultimo_nivel; // Para detectar bordas
+    uint32_t eventos;  // Bordas registradas (INTR)
+    uint32_t habilitados;
+} Pino;
+
+typedef struct
+{
+    uint32_t mascara;
+    irq_handler_t handler;
+} HandlerRaw;
+
+static Pino pinos[NUM_BANK0_GPIOS];
+static HandlerRaw handlers_raw[MAX_HANDLERS_RAW];
+static uint8_t num_handlers_raw = 0;
+static uint32_t mascara_raw = 0;
+static gpio_irq_callback_t callback_gpio = NULL;
+static bool pinos_iniciados = false;
+
+static void iniciar_pinos(void)
+{
+    if (pinos_iniciados)
+        return;
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++)
+        pinos[i] = (Pino){.funcao = GPIO_FUNC_NULL, .externo = -1, .pull = 0};
+    pinos_iniciados = true;
+}
+
+static bool nivel(const Pino *p)
+{
+    if (p->saida && p->funcao == GPIO_FUNC_SIO)
+        return p->valor;
+    if (p->externo >= 0)
+        return p->externo;
+    return p->pull == 1;
+}
+
+/**
+ * @brief Registra a borda, se houve, após qualquer mudança que afete o nível
+ */
+static void atualizar_bordas(uint gpio)
+{
+    Pino *p = &pinos[gpio];
+    bool atual = nivel(p);
+    bool desceu = p->ultimo_nivel && !atual;
+    if (atual != p->ultimo_nivel)
+        p->eventos |= atual ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    p->ultimo_nivel = atual;
+    if (desceu)
+        sim_i2c_borda_descida(gpio);
+}
+
+void gpio_init(uint gpio)
+{
+    iniciar_pinos();
+    pinos[gpio].funcao = GPIO_FUNC_SIO;
+    pinos[gpio].saida = false;
+    pinos[gpio].valor = false;
+    pinos[gpio].ultimo_nivel = nivel(&pinos[gpio]);
+    sim_registrar("gpio", "init pino=%u", gpio);
+}
+
+void gpio_deinit(uint gpio)
+{
+    iniciar_pinos();
+    pinos[gpio].funcao = GPIO_FUNC_NULL;
+    sim_registrar("gpio", "deinit pino=%u", gpio);
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    iniciar_pinos();
+    pinos[gpio].saida = out;
+    sim_registrar("gpio", "dir pino=%u saida=%d", gpio, out);
+    atualizar_bordas(gpio);
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+    iniciar_pinos();
+    pinos[gpio].funcao = fn;
+    sim_registrar("gpio", "funcao pino=%u funcao=%d", gpio, fn);
+}
+
+void gpio_pull_up(uint gpio)
+{
+    iniciar_pinos();
+    pinos[gpio].pull = 1;
+    sim_registrar("gpio", "pull pino=%u up", gpio);
+    atualizar_bordas(gpio);
+}
+
+void gpio_pull_down(uint gpio)
+{
+    iniciar_pinos();
+    pinos[gpio].pull = 0;
+    sim_registrar("gpio", "pull pino=%u down", gpio);
+    atualizar_bordas(gpio);
+}
+
+void gpio_disable_pulls(uint gpio)
+{
+    iniciar_pinos();
+    pinos[gpio].pull = -1;
+    sim_registrar("gpio", "pull pino=%u nenhum", gpio);
+    atualizar_bordas(gpio);
+}
+
+bool gpio_get(uint gpio)
+{
+    iniciar_pinos();
+    return nivel(&pinos[gpio]);
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    iniciar_pinos();
+    pinos[gpio].valor = value;
+    sim_registrar("gpio", "put pino=%u valor=%d", gpio, value);
+    atualizar_bordas(gpio);
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled)
+{
+    iniciar_pinos();
+    if (enabled)
+        pinos[gpio].habilitados |= event_mask;
+    else
+        pinos[gpio].habilitados &= ~event_mask;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback)
+{
+    callback_gpio = callback;
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+}
+
+void gpio_add_raw_irq_handler_masked(uint32_t gpio_mask, irq_handler_t handler)
+{
+    if (num_handlers_raw < MAX_HANDLERS_RAW)
+    {
+        handlers_raw[num_handlers_raw++] = (HandlerRaw){gpio_mask, handler};
+        mascara_raw |= gpio_mask;
+    }
+}
+
+void gpio_add_raw_irq_handler(uint gpio, irq_handler_t handler)
+{
+    gpio_add_raw_irq_handler_masked(1u << gpio, handler);
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio)
+{
+    return pinos[gpio].eventos & pinos[gpio].habilitados;
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask)
+{
+    pinos[gpio].eventos &= ~event_mask;
+}
+
+int sim_gpio_pino_i2c(unsigned indice, bool scl)
+{
+    // No RP2040 o SDA do I2Cn fica nos pinos 4k + 2n e o SCL nos 4k + 2n + 1
+    iniciar_pinos();
+    for (unsigned gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+    {
+        if (pinos[gpio].funcao == GPIO_FUNC_I2C && gpio % 4u == 2u * indice + scl)
+            return (int)gpio;
+    }
+    return -1;
+}
+
+void sim_gpio_nivel_externo(unsigned pino, int nivel_externo)
+{
+    iniciar_pinos();
+    pinos[pino].externo = (int8_t)nivel_externo;
+    sim_registrar("entrada", "pino=%u nivel=%d", pino, nivel_externo);
+    atualizar_bordas(pino);
+}
+
+/**
+ * @brief Despacha as bordas pendentes (contexto de interrupção simulada)
+ *
+ * Como no SDK, pinos com handler "raw" são tratados só pelo handler; os
+ * demais vão para o callback único de gpio_set_irq_enabled_with_callback().
+ */
+void sim_gpio_atender(void)
+{
+    if (!pinos_iniciados)
+        return;
+
+    for (uint gpio = 0; gpio < NUM_BANK0_GPIOS; gpio++)
+    {
+        uint32_t eventos = gpio_get_irq_event_mask(gpio);
+        if (!eventos)
+            continue;
+
+        if (mascara_raw & (1u << gpio))
+        {
+            for (uint8_t h = 0; h < num_handlers_raw; h++)
+            {
+                if (handlers_raw[h].mascara & (1u << gpio))
+                    handlers_raw[h].handler();
+            }
+        }
+        else
+        {
+            gpio_acknowledge_irq(gpio, eventos);
+            if (callback_gpio != NULL)
+                callback_gpio(gpio, eventos);
+        }
+    }
+}
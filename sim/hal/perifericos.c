@@ -0,0 +1,956 @@
+/**
+ * @file perifericos.c
+ * @brief PWM, DMA, ADC, I2C, PIO e clocks da simulação
+ *
+ * Cada escrita de configuração ou de dado é registrada. Os caminhos de
+ * dados modelados são ADC -> DMA em anel, usado pelo amostrador,
+ * memória -> PWM pago pelo wrap do slice, usado pelos fades do LED RGB, e
+ * memória -> FIFO do I2C, usado pelos quadros do OLED vindos da flash.
+ * Um dispositivo I2C pode dar NACK ou travar o barramento por estímulo.
+ */
+
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/adc.h"
+#include "hardware/i2c.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include <string.h>
+
+#define CLK_SYS_HZ 125000000u
+#define CLK_ADC_HZ 48000000u
+#define ADC_CANAIS 5
+
+/* PWM */
+
+static pwm_hw_t pwm_regs;
+pwm_hw_t *pwm_hw = &pwm_regs;
+
+pwm_config pwm_get_default_config(void)
+{
+    return (pwm_config){.csr = 0, .div = 1u << 4, .top = 0xffff};
+}
+
+void pwm_config_set_clkdiv(pwm_config *c, float div)
+{
+    c->div = (uint32_t)(div * 16.0f);
+}
+
+void pwm_config_set_wrap(pwm_config *c, uint16_t wrap)
+{
+    c->top = wrap;
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start)
+{
+    pwm_regs.slice[slice_num].csr = c->csr;
+    pwm_regs.slice[slice_num].div = c->div;
+    pwm_regs.slice[slice_num].top = c->top;
+    pwm_regs.slice[slice_num].cc = 0;
+    if (start)
+        pwm_regs.en |= 1u << slice_num;
+    sim_registrar("pwm", "init slice=%u div=%.4f wrap=%lu ativo=%d", slice_num, c->div / 16.0f,
+                  (unsigned long)c->top, start);
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap)
+{
+    pwm_regs.slice[slice_num].top = wrap;
+    sim_registrar("pwm", "wrap slice=%u wrap=%u", slice_num, wrap);
+}
+
+void pwm_set_clkdiv(uint slice_num, float divider)
+{
+    pwm_regs.slice[slice_num].div = (uint32_t)(divider * 16.0f);
+    sim_registrar("pwm", "clkdiv slice=%u div=%.4f", slice_num, divider);
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled)
+{
+    if (enabled)
+        pwm_regs.en |= 1u << slice_num;
+    else
+        pwm_regs.en &= ~(1u << slice_num);
+    sim_registrar("pwm", "enable slice=%u ativo=%d", slice_num, enabled);
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level)
+{
+    uint32_t cc = pwm_regs.slice[slice_num].cc;
+    cc = chan ? ((cc & 0xffffu) | ((uint32_t)level << 16)) : ((cc & 0xffff0000u) | level);
+    pwm_regs.slice[slice_num].cc = cc;
+    sim_registrar("pwm", "nivel slice=%u canal=%c nivel=%u", slice_num, chan ? 'B' : 'A', level);
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level)
+{
+    pwm_set_chan_level(pwm_gpio_to_slice_num(gpio), pwm_gpio_to_channel(gpio), level);
+}
+
+/* Falhas dos dispositivos I2C */
+
+#define PULSOS_ESCRAVO_PRESO 3 // Pulsos de SCL até o escravo preso terminar o byte
+
+static SimFalhaI2C falhas_i2c[128];
+
+// Escravo que travou no meio de um byte segurando o SDA
+static struct
+{
+    bool segurando;
+    int sda, scl;
+    uint8_t pulsos;
+} escravo_preso = {.sda = -1, .scl = -1};
+
+void sim_i2c_definir_falha(unsigned endereco, SimFalhaI2C falha)
+{
+    falhas_i2c[endereco & 0x7Fu] = falha;
+    sim_registrar("entrada", "i2c endereco=0x%02x falha=%d", endereco & 0x7Fu, falha);
+}
+
+/**
+ * @brief Começo de uma transferência: o que o dispositivo endereçado faz
+ *
+ * Limpa o aborto anterior (o IC_CLR_TX_ABRT não limpa nada aqui). Um
+ * dispositivo marcado como preso trava nesta transferência, uma vez só, e
+ * daí em diante todas ficam presas até o SDA ser solto.
+ */
+static SimFalhaI2C enderecar_i2c(i2c_inst_t *i2c, uint8_t endereco)
+{
+    i2c->regs.raw_intr_stat = 0;
+    i2c->regs.tx_abrt_source = 0;
+    if (!escravo_preso.segurando && falhas_i2c[endereco & 0x7Fu] == SIM_I2C_PRESO)
+    {
+        falhas_i2c[endereco & 0x7Fu] = SIM_I2C_OK;
+        escravo_preso.segurando = true;
+        escravo_preso.sda = sim_gpio_pino_i2c(i2c->indice, false);
+        escravo_preso.scl = sim_gpio_pino_i2c(i2c->indice, true);
+        escravo_preso.pulsos = 0;
+        sim_registrar(i2c->indice ? "i2c1" : "i2c0", "preso endereco=0x%02x", endereco);
+        if (escravo_preso.sda >= 0)
+            sim_gpio_nivel_externo((unsigned)escravo_preso.sda, 0);
+    }
+    if (escravo_preso.segurando)
+        return SIM_I2C_PRESO;
+    return falhas_i2c[endereco & 0x7Fu];
+}
+
+void sim_i2c_borda_descida(unsigned pino)
+{
+    if (!escravo_preso.segurando || (int)pino != escravo_preso.scl)
+        return;
+    if (++escravo_preso.pulsos < PULSOS_ESCRAVO_PRESO)
+        return;
+    escravo_preso.segurando = false;
+    sim_registrar("i2c", "solto pulsos=%u", escravo_preso.pulsos);
+    sim_gpio_nivel_externo((unsigned)escravo_preso.sda, -1);
+}
+
+/* DMA */
+
+typedef struct
+{
+    bool reservado;
+    bool ocupado;
+    bool irq0;
+    bool irq0_pendente;
+    bool irq1;
+    bool irq1_pendente;
+    dma_channel_config cfg;
+    volatile void *escrita;
+    const volatile void *leitura;
+    uint64_t ultimo_wrap_us; // DREQ de PWM: instante da última transferência
+    uint64_t fim_i2c_us;     // DREQ de I2C: fim do fio da transferência inteira
+    bool nack_i2c;           // DREQ de I2C: o endereço fica sem ACK
+} CanalDma;
+
+static dma_hw_t dma_regs;
+dma_hw_t *dma_hw = &dma_regs;
+static CanalDma canais[NUM_DMA_CHANNELS];
+static bool timers_dma[NUM_DMA_TIMERS];
+
+int dma_claim_unused_channel(bool required)
+{
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (!canais[c].reservado)
+        {
+            canais[c].reservado = true;
+            return c;
+        }
+    }
+    if (required)
+        panic("dma: sem canais livres");
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    return (dma_channel_config){
+        .tamanho = DMA_SIZE_32,
+        .incrementa_leitura = true,
+        .incrementa_escrita = false,
+        .dreq = DREQ_FORCE,
+        .encadear = (uint8_t)channel,
+    };
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->tamanho = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->incrementa_leitura = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->incrementa_escrita = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+    c->dreq = (uint8_t)dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->encadear = (uint8_t)chain_to;
+}
+
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits)
+{
+    c->anel_na_escrita = write;
+    c->bits_anel = (uint8_t)size_bits;
+}
+
+static bool pago_pelo_pwm(const CanalDma *canal)
+{
+    return canal->ocupado && canal->cfg.dreq >= DREQ_PWM_WRAP0 && canal->cfg.dreq < DREQ_PWM_WRAP0 + NUM_PWM_SLICES;
+}
+
+static i2c_inst_t *pago_pelo_i2c(const CanalDma *canal)
+{
+    if (!canal->ocupado)
+        return NULL;
+    if (canal->cfg.dreq == i2c_get_dreq(i2c0, true))
+        return i2c0;
+    if (canal->cfg.dreq == i2c_get_dreq(i2c1, true))
+        return i2c1;
+    return NULL;
+}
+
+static void avancar_pwm(uint channel, uint64_t agora_us);
+static SimFalhaI2C enderecar_i2c(i2c_inst_t *i2c, uint8_t endereco);
+
+static void disparar(uint channel)
+{
+    canais[channel].ocupado = dma_regs.ch[channel].transfer_count > 0;
+    if (pago_pelo_pwm(&canais[channel]))
+    {
+        // O fim da contagem pode vir antes do próximo prazo da task de interrupções
+        canais[channel].ultimo_wrap_us = time_us_64();
+        sim_acordar_interrupcoes();
+    }
+    i2c_inst_t *i2c = pago_pelo_i2c(&canais[channel]);
+    if (i2c != NULL)
+    {
+        // 9 bits por byte (8 + ACK), mais o byte de endereço; sem ACK, só o
+        // endereço. Preso, o fio não termina.
+        SimFalhaI2C falha = enderecar_i2c(i2c, (uint8_t)i2c->regs.tar);
+        uint64_t bits = (falha == SIM_I2C_NACK) ? 9u : (dma_regs.ch[channel].transfer_count + 1u) * 9u;
+        canais[channel].nack_i2c = falha == SIM_I2C_NACK;
+        canais[channel].fim_i2c_us = (falha == SIM_I2C_PRESO)
+                                         ? UINT64_MAX
+                                         : time_us_64() + bits * 1000000u / (i2c->baudrate ? i2c->baudrate : 100000u);
+        i2c->regs.status = I2C_IC_STATUS_MST_ACTIVITY_BITS;
+        sim_acordar_interrupcoes();
+    }
+    sim_registrar("dma", "inicio canal=%u destino=%s origem=%s n=%lu dreq=%u", channel,
+                  sim_nome_endereco(canais[channel].escrita), sim_nome_endereco(canais[channel].leitura),
+                  (unsigned long)dma_regs.ch[channel].transfer_count, canais[channel].cfg.dreq);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+    canais[channel].cfg = *config;
+    canais[channel].escrita = write_addr;
+    canais[channel].leitura = read_addr;
+    dma_regs.ch[channel].write_addr = (uint32_t)(uintptr_t)write_addr;
+    dma_regs.ch[channel].read_addr = (uint32_t)(uintptr_t)read_addr;
+    dma_regs.ch[channel].transfer_count = transfer_count;
+    sim_registrar("dma", "config canal=%u tamanho=%u dreq=%u encadear=%u anel=%u", channel, 1u << config->tamanho,
+                  config->dreq, config->encadear, config->bits_anel);
+    if (trigger)
+        disparar(channel);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+    canais[channel].leitura = read_addr;
+    dma_regs.ch[channel].read_addr = (uint32_t)(uintptr_t)read_addr;
+    if (trigger)
+        disparar(channel);
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger)
+{
+    canais[channel].escrita = write_addr;
+    dma_regs.ch[channel].write_addr = (uint32_t)(uintptr_t)write_addr;
+    if (trigger)
+        disparar(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger)
+{
+    dma_regs.ch[channel].transfer_count = trans_count;
+    if (trigger)
+        disparar(channel);
+}
+
+void dma_channel_start(uint channel)
+{
+    disparar(channel);
+}
+
+void dma_start_channel_mask(uint32_t chan_mask)
+{
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (chan_mask & (1u << c))
+            disparar(c);
+    }
+}
+
+void dma_channel_abort(uint channel)
+{
+    // As transferências dos wraps já decorridos acontecem antes do abort
+    avancar_pwm(channel, time_us_64());
+    i2c_inst_t *i2c = pago_pelo_i2c(&canais[channel]);
+    if (i2c != NULL)
+        i2c->regs.status = escravo_preso.segurando ? I2C_IC_STATUS_MST_ACTIVITY_BITS : I2C_IC_STATUS_TFE_BITS;
+    canais[channel].ocupado = false;
+    sim_registrar("dma", "aborta canal=%u", channel);
+}
+
+dma_channel_hw_t *dma_channel_hw_addr(uint channel)
+{
+    // Quem lê os registradores do canal (ex.: a contagem) vê os wraps já decorridos
+    avancar_pwm(channel, time_us_64());
+    return &dma_regs.ch[channel];
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    return canais[channel].ocupado;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+    canais[channel].irq0 = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+    return canais[channel].irq0_pendente;
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+    canais[channel].irq0_pendente = false;
+}
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+    canais[channel].irq1 = enabled;
+}
+
+bool dma_channel_get_irq1_status(uint channel)
+{
+    return canais[channel].irq1_pendente;
+}
+
+void dma_channel_acknowledge_irq1(uint channel)
+{
+    canais[channel].irq1_pendente = false;
+}
+
+int dma_claim_unused_timer(bool required)
+{
+    for (int t = 0; t < NUM_DMA_TIMERS; t++)
+    {
+        if (!timers_dma[t])
+        {
+            timers_dma[t] = true;
+            return t;
+        }
+    }
+    if (required)
+        panic("dma: sem timers livres");
+    return -1;
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator)
+{
+    dma_regs.timer[timer] = ((uint32_t)numerator << 16) | denominator;
+    sim_registrar("dma", "timer=%u fracao=%u/%u", timer, numerator, denominator);
+}
+
+/**
+ * @brief Período do contador de um slice PWM: (top + 1) * div / clk_sys
+ */
+static double periodo_wrap_us(uint slice)
+{
+    return (pwm_regs.slice[slice].top + 1.0) * (pwm_regs.slice[slice].div / 16.0) * 1e6 /
+           (double)clock_get_hz(clk_sys);
+}
+
+/**
+ * @brief Faz as transferências de um canal pago pelo wrap de um slice PWM
+ *
+ * Uma por wrap decorrido desde a última; com o slice parado não há DREQ.
+ * O valor final do registrador de destino é registrado no fim da contagem.
+ */
+static void avancar_pwm(uint channel, uint64_t agora_us)
+{
+    CanalDma *canal = &canais[channel];
+    if (!pago_pelo_pwm(canal))
+        return;
+
+    uint slice = canal->cfg.dreq - DREQ_PWM_WRAP0;
+    if (!(pwm_regs.en & (1u << slice)))
+    {
+        canal->ultimo_wrap_us = agora_us;
+        return;
+    }
+
+    double periodo_us = periodo_wrap_us(slice);
+    uint64_t wraps = (uint64_t)((double)(agora_us - canal->ultimo_wrap_us) / periodo_us);
+    if (wraps == 0)
+        return;
+    canal->ultimo_wrap_us += (uint64_t)((double)wraps * periodo_us);
+
+    uintptr_t origem = (uintptr_t)canal->leitura;
+    uintptr_t destino = (uintptr_t)canal->escrita;
+    uintptr_t mascara_anel = canal->cfg.bits_anel ? ((uintptr_t)1 << canal->cfg.bits_anel) - 1 : ~(uintptr_t)0;
+    uint32_t passo = 1u << canal->cfg.tamanho;
+    for (; wraps > 0 && dma_regs.ch[channel].transfer_count > 0; wraps--)
+    {
+        if (canal->cfg.tamanho == DMA_SIZE_32)
+            *(volatile uint32_t *)destino = *(const volatile uint32_t *)origem;
+        else if (canal->cfg.tamanho == DMA_SIZE_16)
+            *(volatile uint16_t *)destino = *(const volatile uint16_t *)origem;
+        else
+            *(volatile uint8_t *)destino = *(const volatile uint8_t *)origem;
+
+        // Anel na leitura ou na escrita, como no hardware (ex.: tabela de endereços relida em laço)
+        if (canal->cfg.incrementa_leitura)
+            origem = canal->cfg.anel_na_escrita ? origem + passo : (origem & ~mascara_anel) | ((origem + passo) & mascara_anel);
+        if (canal->cfg.incrementa_escrita)
+            destino = !canal->cfg.anel_na_escrita ? destino + passo : (destino & ~mascara_anel) | ((destino + passo) & mascara_anel);
+        dma_regs.ch[channel].transfer_count--;
+    }
+    canal->leitura = (const volatile void *)origem;
+    canal->escrita = (volatile void *)destino;
+
+    if (dma_regs.ch[channel].transfer_count == 0)
+    {
+        canal->ocupado = false;
+        canal->irq0_pendente = canal->irq0;
+        canal->irq1_pendente = canal->irq1;
+        sim_registrar("dma", "fim canal=%u destino=%s valor=0x%08lx", channel, sim_nome_endereco(canal->escrita),
+                      (unsigned long)*(volatile uint32_t *)canal->escrita);
+
+        // Fim visto fora da task de interrupções (abort, leitura da contagem): o handler roda já
+        if (canal->irq0 || canal->irq1)
+            sim_acordar_interrupcoes();
+    }
+}
+
+void sim_pwm_dma_atender(uint64_t agora_us)
+{
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++)
+        avancar_pwm(c, agora_us);
+}
+
+uint64_t sim_pwm_dma_proximo_us(void)
+{
+    uint64_t proximo = UINT64_MAX;
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        const CanalDma *canal = &canais[c];
+        if (!pago_pelo_pwm(canal) || !(pwm_regs.en & (1u << (canal->cfg.dreq - DREQ_PWM_WRAP0))))
+            continue;
+        double periodo_us = periodo_wrap_us(canal->cfg.dreq - DREQ_PWM_WRAP0);
+        uint64_t fim = canal->ultimo_wrap_us + (uint64_t)((double)dma_regs.ch[c].transfer_count * periodo_us) + 1u;
+        if (fim < proximo)
+            proximo = fim;
+    }
+    return proximo;
+}
+
+/**
+ * @brief Fim de um canal que enche o FIFO do I2C
+ *
+ * O quadro inteiro sai no fim do tempo de fio e é registrado como uma
+ * escrita do i2c_write_blocking(): os bytes baixos das palavras, endereço do
+ * TAR e STOP conforme a última palavra. Sem ACK no endereço o controlador
+ * aborta e o FIFO descarta o resto, que o canal termina de encher.
+ */
+static void avancar_i2c(uint channel, uint64_t agora_us)
+{
+    CanalDma *canal = &canais[channel];
+    i2c_inst_t *i2c = pago_pelo_i2c(canal);
+    if (i2c == NULL || agora_us < canal->fim_i2c_us)
+        return;
+
+    const volatile uint16_t *palavras = canal->leitura;
+    uint32_t n = dma_regs.ch[channel].transfer_count;
+    uint16_t ultima = n ? palavras[n - 1] : 0;
+    i2c->regs.data_cmd = ultima;
+    if (canal->nack_i2c)
+    {
+        i2c->regs.raw_intr_stat = I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS;
+        i2c->regs.tx_abrt_source = I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS;
+        sim_registrar(i2c->indice ? "i2c1" : "i2c0", "nack endereco=0x%02lx n=%lu", (unsigned long)i2c->regs.tar,
+                      (unsigned long)n);
+    }
+    else
+    {
+        uint32_t hash = sim_hash(NULL, 0);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            uint8_t byte = (uint8_t)palavras[i];
+            hash = sim_hash_continuar(hash, &byte, 1);
+        }
+        sim_registrar(i2c->indice ? "i2c1" : "i2c0",
+                      "escrita endereco=0x%02lx n=%lu primeiro=0x%02x hash=%08lx stop=%d", (unsigned long)i2c->regs.tar,
+                      (unsigned long)n, n ? (uint8_t)palavras[0] : 0, (unsigned long)hash,
+                      (ultima & I2C_IC_DATA_CMD_STOP_BITS) != 0);
+    }
+
+    canal->leitura = palavras + n;
+    dma_regs.ch[channel].transfer_count = 0;
+    i2c->regs.status = I2C_IC_STATUS_TFE_BITS;
+    canal->ocupado = false;
+    canal->irq0_pendente = canal->irq0;
+    canal->irq1_pendente = canal->irq1;
+    sim_registrar("dma", "fim canal=%u destino=%s valor=0x%08lx", channel, sim_nome_endereco(canal->escrita),
+                  (unsigned long)i2c->regs.data_cmd);
+}
+
+void sim_i2c_dma_atender(uint64_t agora_us)
+{
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++)
+        avancar_i2c(c, agora_us);
+}
+
+uint64_t sim_i2c_dma_proximo_us(void)
+{
+    uint64_t proximo = UINT64_MAX;
+    for (uint c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (pago_pelo_i2c(&canais[c]) && canais[c].fim_i2c_us < proximo)
+            proximo = canais[c].fim_i2c_us;
+    }
+    return proximo;
+}
+
+/* ADC */
+
+static adc_hw_t adc_regs;
+adc_hw_t *adc_hw = &adc_regs;
+static uint16_t valores_adc[ADC_CANAIS];
+static uint8_t canal_adc = 0;
+static uint8_t round_robin = 0;
+static float divisor_adc = 0.0f;
+static bool adc_rodando = false;
+static uint64_t ultima_conversao_us = 0;
+static uint64_t ultima_mudanca_us = 0;
+
+#define JANELA_MUDANCA_ADC_US 50000 // Após uma mudança de valor, conversões a cada tick
+
+void adc_init(void)
+{
+    sim_registrar("adc", "init");
+}
+
+void adc_gpio_init(uint gpio)
+{
+    gpio_set_function(gpio, GPIO_FUNC_NULL);
+}
+
+void adc_select_input(uint input)
+{
+    canal_adc = (uint8_t)input;
+    sim_registrar("adc", "canal=%u", input);
+}
+
+void adc_set_round_robin(uint input_mask)
+{
+    round_robin = (uint8_t)input_mask;
+    sim_registrar("adc", "round_robin=0x%02x", input_mask);
+}
+
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift)
+{
+    sim_registrar("adc", "fifo en=%d dreq=%d limiar=%u erro=%d byte=%d", en, dreq_en, dreq_thresh, err_in_fifo,
+                  byte_shift);
+}
+
+void adc_set_clkdiv(float clkdiv)
+{
+    divisor_adc = clkdiv;
+    sim_registrar("adc", "clkdiv=%.2f", clkdiv);
+}
+
+void adc_run(bool run)
+{
+    adc_rodando = run;
+    ultima_conversao_us = time_us_64();
+    sim_registrar("adc", "run=%d", run);
+}
+
+void adc_fifo_drain(void)
+{
+}
+
+uint16_t adc_read(void)
+{
+    return valores_adc[canal_adc];
+}
+
+void sim_adc_definir(unsigned canal, uint16_t valor)
+{
+    // As conversões até agora ainda são do valor anterior
+    uint64_t agora = time_us_64();
+    sim_adc_atender(agora);
+    ultima_mudanca_us = agora;
+
+    if (canal < ADC_CANAIS)
+        valores_adc[canal] = valor & 0x0fff;
+    sim_registrar("entrada", "adc canal=%u valor=%u", canal, valor);
+}
+
+/**
+ * @brief Avança o ADC em modo livre e o canal de DMA que lê o FIFO
+ *
+ * Gera as conversões do intervalo decorrido, na ordem do round-robin, e as
+ * escreve no destino do DMA respeitando o anel de escrita.
+ */
+void sim_adc_atender(uint64_t agora_us)
+{
+    if (!adc_rodando)
+        return;
+
+    float periodo_us = (1.0f + divisor_adc) * 1e6f / (float)CLK_ADC_HZ;
+    uint32_t conversoes = (uint32_t)((float)(agora_us - ultima_conversao_us) / periodo_us);
+    if (conversoes == 0)
+        return;
+    ultima_conversao_us += (uint64_t)((float)conversoes * periodo_us);
+
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        CanalDma *canal = &canais[c];
+        if (!canal->ocupado || canal->cfg.dreq != DREQ_ADC || canal->leitura != &adc_regs.fifo)
+            continue;
+
+        uintptr_t destino = (uintptr_t)canal->escrita;
+        uintptr_t mascara_anel = canal->cfg.bits_anel ? ((uintptr_t)1 << canal->cfg.bits_anel) - 1 : ~(uintptr_t)0;
+        uint32_t passo = 1u << canal->cfg.tamanho;
+
+        for (uint32_t i = 0; i < conversoes && dma_regs.ch[c].transfer_count > 0; i++)
+        {
+            uint16_t amostra = valores_adc[canal_adc];
+            if (canal->cfg.tamanho == DMA_SIZE_16)
+                *(volatile uint16_t *)destino = amostra;
+            else if (canal->cfg.tamanho == DMA_SIZE_8)
+                *(volatile uint8_t *)destino = (uint8_t)(amostra >> 4);
+            else
+                *(volatile uint32_t *)destino = amostra;
+
+            if (canal->cfg.incrementa_escrita)
+                destino = (destino & ~mascara_anel) | ((destino + passo) & mascara_anel);
+            dma_regs.ch[c].transfer_count--;
+
+            // Próximo canal habilitado no round-robin
+            if (round_robin)
+            {
+                do
+                    canal_adc = (uint8_t)((canal_adc + 1) % ADC_CANAIS);
+                while (!(round_robin & (1u << canal_adc)));
+            }
+        }
+        canal->escrita = (volatile void *)destino;
+        if (dma_regs.ch[c].transfer_count == 0)
+        {
+            canal->ocupado = false;
+            canal->irq0_pendente = canal->irq0;
+            canal->irq1_pendente = canal->irq1;
+        }
+    }
+}
+
+/**
+ * @brief Próximo instante em que o ADC precisa ser atendido
+ *
+ * Logo depois de uma mudança de valor, a cada tick, para que as médias dos
+ * detectores (lidas direto do anel) acompanhem a transição; fora disso, só
+ * no fim da contagem do DMA, já que o anel só repete o mesmo valor.
+ */
+uint64_t sim_adc_proximo_us(uint64_t agora_us)
+{
+    if (!adc_rodando)
+        return UINT64_MAX;
+    if (agora_us < ultima_mudanca_us + JANELA_MUDANCA_ADC_US)
+        return agora_us + 1000u;
+
+    float periodo_us = (1.0f + divisor_adc) * 1e6f / (float)CLK_ADC_HZ;
+    uint64_t proximo = UINT64_MAX;
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (!canais[c].ocupado || canais[c].cfg.dreq != DREQ_ADC)
+            continue;
+        uint64_t fim = ultima_conversao_us + (uint64_t)((double)dma_regs.ch[c].transfer_count * periodo_us);
+        if (fim < proximo)
+            proximo = fim;
+    }
+    return proximo;
+}
+
+bool sim_dma_irq0_pendente(void)
+{
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (canais[c].irq0_pendente)
+            return true;
+    }
+    return false;
+}
+
+bool sim_dma_irq1_pendente(void)
+{
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (canais[c].irq1_pendente)
+            return true;
+    }
+    return false;
+}
+
+/* I2C */
+
+i2c_inst_t i2c0_inst = {.indice = 0, .regs.status = I2C_IC_STATUS_TFE_BITS};
+i2c_inst_t i2c1_inst = {.indice = 1, .regs.status = I2C_IC_STATUS_TFE_BITS};
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate)
+{
+    i2c->baudrate = baudrate;
+    i2c->regs.status = I2C_IC_STATUS_TFE_BITS;
+    i2c->regs.raw_intr_stat = 0;
+    i2c->regs.tx_abrt_source = 0;
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "init baudrate=%u", baudrate);
+    return baudrate;
+}
+
+void i2c_deinit(i2c_inst_t *i2c)
+{
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "deinit");
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate)
+{
+    i2c->baudrate = baudrate;
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "baudrate=%u", baudrate);
+    return baudrate;
+}
+
+/**
+ * @brief Resultado de uma transferência do SDK que falhou, como as versões com prazo
+ *
+ * As bloqueantes travariam para sempre com o barramento preso; aqui voltam
+ * como se tivessem prazo.
+ */
+static int falha_i2c(i2c_inst_t *i2c, uint8_t addr, SimFalhaI2C falha)
+{
+    if (falha == SIM_I2C_NACK)
+    {
+        sim_registrar(i2c->indice ? "i2c1" : "i2c0", "nack endereco=0x%02x", addr);
+        return PICO_ERROR_GENERIC;
+    }
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "tempo esgotado endereco=0x%02x", addr);
+    return PICO_ERROR_TIMEOUT;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    i2c->regs.tar = addr;
+    SimFalhaI2C falha = enderecar_i2c(i2c, addr);
+    if (falha != SIM_I2C_OK)
+        return falha_i2c(i2c, addr, falha);
+    // Blocos grandes (quadros do display) vão resumidos por hash
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "escrita endereco=0x%02x n=%zu primeiro=0x%02x hash=%08lx stop=%d",
+                  addr, len, len ? src[0] : 0, (unsigned long)sim_hash(src, len), !nostop);
+    return (int)len;
+}
+
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop,
+                         uint timeout_us)
+{
+    (void)timeout_us;
+    return i2c_write_blocking(i2c, addr, src, len, nostop);
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    i2c->regs.tar = addr;
+    SimFalhaI2C falha = enderecar_i2c(i2c, addr);
+    if (falha != SIM_I2C_OK)
+        return falha_i2c(i2c, addr, falha);
+    memset(dst, 0, len);
+    sim_registrar(i2c->indice ? "i2c1" : "i2c0", "leitura endereco=0x%02x n=%zu stop=%d", addr, len, !nostop);
+    return (int)len;
+}
+
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us)
+{
+    (void)timeout_us;
+    return i2c_read_blocking(i2c, addr, dst, len, nostop);
+}
+
+/* PIO */
+
+pio_hw_t pio0_hw_sim = {.indice = 0};
+pio_hw_t pio1_hw_sim = {.indice = 1};
+
+uint pio_add_program(PIO pio, const pio_program_t *program)
+{
+    uint offset = 32u - pio->memoria_usada - program->length;
+    pio->memoria_usada += program->length;
+    sim_registrar(pio->indice ? "pio1" : "pio0", "programa n=%u offset=%u hash=%08lx", program->length, offset,
+                  (unsigned long)sim_hash(program->instructions, program->length * sizeof(uint16_t)));
+    return offset;
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+    for (int sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++)
+    {
+        if (!(pio->sm_usadas & (1u << sm)))
+        {
+            pio->sm_usadas |= 1u << sm;
+            return sm;
+        }
+    }
+    if (required)
+        panic("pio: sem maquinas de estado livres");
+    return -1;
+}
+
+void pio_gpio_init(PIO pio, uint pin)
+{
+    gpio_set_function(pin, pio->indice ? GPIO_FUNC_PIO1 : GPIO_FUNC_PIO0);
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out)
+{
+    sim_registrar(pio->indice ? "pio1" : "pio0", "pindirs sm=%u base=%u n=%u saida=%d", sm, pin_base, pin_count,
+                  is_out);
+}
+
+pio_sm_config pio_get_default_sm_config(void)
+{
+    return (pio_sm_config){.clkdiv = 1u << 16};
+}
+
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base)
+{
+    c->pinctrl = sideset_base;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold)
+{
+    c->shiftctrl = (shift_right ? 1u : 0u) | (autopull ? 2u : 0u) | (pull_threshold << 8);
+}
+
+void sm_config_set_fifo_join(pio_sm_config *c, int join)
+{
+    c->execctrl = (uint32_t)join;
+}
+
+void sm_config_set_clkdiv(pio_sm_config *c, float div)
+{
+    c->clkdiv = (uint32_t)(div * 65536.0f);
+}
+
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div)
+{
+    sim_registrar(pio->indice ? "pio1" : "pio0", "clkdiv sm=%u clkdiv=%.3f", sm, div);
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config)
+{
+    sim_registrar(pio->indice ? "pio1" : "pio0", "init sm=%u pc=%u clkdiv=%.3f", sm, initial_pc,
+                  config->clkdiv / 65536.0f);
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    sim_registrar(pio->indice ? "pio1" : "pio0", "enable sm=%u ativo=%d", sm, enabled);
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data)
+{
+    pio->txf[sm] = data;
+    sim_registrar(pio->indice ? "pio1" : "pio0", "put sm=%u dado=0x%08lx", sm, (unsigned long)data);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+    pio_sm_put(pio, sm, data);
+}
+
+/* Clocks */
+
+static uint32_t clk_sys_hz = CLK_SYS_HZ;
+static uint32_t clk_peri_hz = 0; // 0: segue o clk_sys, como depois do boot
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+    switch (clk_index)
+    {
+    case clk_adc:
+    case clk_usb:
+        return CLK_ADC_HZ;
+    case clk_ref:
+        return 12000000u;
+    case clk_peri:
+        return clk_peri_hz ? clk_peri_hz : clk_sys_hz;
+    default:
+        return clk_sys_hz;
+    }
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required)
+{
+    (void)required;
+    clk_sys_hz = freq_khz * 1000u;
+    sim_registrar("clocks", "sys_khz=%lu", (unsigned long)freq_khz);
+    return true;
+}
+
+bool clock_configure(enum clock_index clk_index, uint32_t src, uint32_t auxsrc, uint32_t src_freq, uint32_t freq)
+{
+    // Só o clk_peri é modelado: com outra fonte ele deixa de seguir o clk_sys
+    (void)src;
+    (void)src_freq;
+    if (clk_index == clk_peri)
+        clk_peri_hz = (auxsrc == CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS) ? 0 : freq;
+    sim_registrar("clocks", "configure clk=%u auxsrc=%lu hz=%lu", (unsigned)clk_index, (unsigned long)auxsrc,
+                  (unsigned long)freq);
+    return true;
+}
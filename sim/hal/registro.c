@@ -0,0 +1,214 @@
+/**
+ * @file registro.c
+ * @brief Registro das escritas em periféricos da simulação
+ */
+
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/adc.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static FILE *arquivo = NULL;
+static const char *filtro = NULL; // Prefixos aceitos, separados por vírgula (NULL = todos)
+
+/**
+ * @brief Exclusão mútua entre tasks sem risco de troca no meio da escrita
+ *
+ * No port POSIX a troca de contexto acontece no handler do sinal do tick;
+ * suspender o escalonador impede que uma task pare segurando o lock do stdio.
+ */
+static bool suspender(void)
+{
+    if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+        return false;
+    vTaskSuspendAll();
+    return true;
+}
+
+static void retomar(bool suspenso)
+{
+    if (suspenso)
+        xTaskResumeAll();
+}
+
+/**
+ * @brief Confere o periférico contra SEMAFORO_SIM_FILTRO
+ */
+static bool aceito(const char *periferico)
+{
+    if (filtro == NULL)
+        return true;
+
+    for (const char *p = filtro; *p != '\0';)
+    {
+        const char *virgula = strchr(p, ',');
+        size_t n = virgula ? (size_t)(virgula - p) : strlen(p);
+        if (n > 0 && strncmp(periferico, p, n) == 0)
+            return true;
+        if (virgula == NULL)
+            break;
+        p = virgula + 1;
+    }
+    return false;
+}
+
+void sim_registrar(const char *periferico, const char *formato, ...)
+{
+    if (arquivo == NULL)
+    {
+        const char *caminho = getenv("SEMAFORO_SIM_REGISTRO");
+        arquivo = fopen(caminho ? caminho : "perifericos.log", "w");
+        if (arquivo == NULL)
+            return;
+        filtro = getenv("SEMAFORO_SIM_FILTRO");
+    }
+    if (!aceito(periferico))
+        return;
+
+    bool suspenso = suspender();
+    va_list args;
+    va_start(args, formato);
+    fprintf(arquivo, "%llu %s ", (unsigned long long)time_us_64(), periferico);
+    vfprintf(arquivo, formato, args);
+    fputc('\n', arquivo);
+    va_end(args);
+    retomar(suspenso);
+}
+
+void sim_encerrar_registro(void)
+{
+    if (arquivo != NULL)
+    {
+        fclose(arquivo);
+        arquivo = NULL;
+    }
+}
+
+uint32_t sim_hash(const void *dados, size_t tamanho)
+{
+    return sim_hash_continuar(2166136261u, dados, tamanho);
+}
+
+uint32_t sim_hash_continuar(uint32_t hash, const void *dados, size_t tamanho)
+{
+    const uint8_t *p = dados;
+    for (size_t i = 0; i < tamanho; i++)
+    {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+const char *sim_nome_endereco(const volatile void *endereco)
+{
+    static char nome[32];
+    const volatile uint8_t *e = endereco;
+
+    for (unsigned s = 0; s < NUM_PWM_SLICES; s++)
+    {
+        if (e == (const volatile uint8_t *)&pwm_hw->slice[s].cc)
+        {
+            snprintf(nome, sizeof(nome), "pwm.slice%u.cc", s);
+            return nome;
+        }
+    }
+    if (e == (const volatile uint8_t *)&adc_hw->fifo)
+        return "adc.fifo";
+    if (e == (const volatile uint8_t *)&i2c_get_hw(i2c0)->data_cmd)
+        return "i2c0.data_cmd";
+    if (e == (const volatile uint8_t *)&i2c_get_hw(i2c1)->data_cmd)
+        return "i2c1.data_cmd";
+    for (unsigned c = 0; c < NUM_DMA_CHANNELS; c++)
+    {
+        if (e == (const volatile uint8_t *)&dma_hw->ch[c].al3_read_addr_trig)
+        {
+            snprintf(nome, sizeof(nome), "dma.ch%u.al3_read_addr_trig", c);
+            return nome;
+        }
+    }
+    for (unsigned sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++)
+    {
+        if (e == (const volatile uint8_t *)&pio0->txf[sm] || e == (const volatile uint8_t *)&pio1->txf[sm])
+        {
+            snprintf(nome, sizeof(nome), "pio%u.txf%u", (e == (const volatile uint8_t *)&pio0->txf[sm]) ? 0u : 1u, sm);
+            return nome;
+        }
+    }
+    return "ram";
+}
+
+/**
+ * @brief Copia a saída do firmware para o registro, uma linha por vez
+ */
+static void registrar_console(const char *texto)
+{
+    static char linha[256];
+    static size_t tamanho = 0;
+
+    for (; *texto != '\0'; texto++)
+    {
+        if (*texto == '\n')
+        {
+            linha[tamanho] = '\0';
+            sim_registrar("console", "%s", linha);
+            tamanho = 0;
+        }
+        else if (tamanho < sizeof(linha) - 1)
+            linha[tamanho++] = *texto;
+    }
+}
+
+/*
+ * printf/puts/putchar do firmware passam por aqui (-Wl,--wrap), pelo mesmo
+ * motivo de sim_registrar(). O texto também vai para o registro, com o
+ * tempo da simulação.
+ */
+int __wrap_printf(const char *formato, ...)
+{
+    char texto[512];
+    bool suspenso = suspender();
+    va_list args;
+    va_start(args, formato);
+    int n = vsnprintf(texto, sizeof(texto), formato, args);
+    va_end(args);
+    fputs(texto, stdout);
+    fflush(stdout);
+    registrar_console(texto);
+    retomar(suspenso);
+    return n;
+}
+
+int __real_puts(const char *s);
+
+int __wrap_puts(const char *s)
+{
+    bool suspenso = suspender();
+    int n = __real_puts(s);
+    fflush(stdout);
+    registrar_console(s);
+    registrar_console("\n");
+    retomar(suspenso);
+    return n;
+}
+
+int __real_putchar(int c);
+
+int __wrap_putchar(int c)
+{
+    bool suspenso = suspender();
+    int n = __real_putchar(c);
+    char texto[2] = {(char)c, '\0'};
+    registrar_console(texto);
+    retomar(suspenso);
+    return n;
+}
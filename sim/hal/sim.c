@@ -0,0 +1,271 @@
+/**
+ * @file sim.c
+ * @brief Inicialização, interrupções simuladas e funções de sistema
+ */
+
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "pico/bootrom.h"
+#include "hardware/irq.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_HANDLERS_IRQ 4
+#define ESPERA_MAX_INTERRUPCOES_MS 1000 // Sem eventos, acorda assim mesmo para conferir o fim
+
+static irq_handler_t handlers[NUM_IRQS][MAX_HANDLERS_IRQ];
+static bool irq_habilitada[NUM_IRQS];
+static uint64_t fim_us = 0; // 0 = sem limite
+static TaskHandle_t tarefa_irq = NULL;
+static struct timespec inicio_real;
+
+// Entrada do console (estímulos "console"), lida por getchar_timeout_us()
+#define TAMANHO_ENTRADA_CONSOLE 256
+static char entrada_console[TAMANHO_ENTRADA_CONSOLE];
+static size_t entrada_escrita = 0, entrada_lida = 0;
+static void (*aviso_caracteres)(void *) = NULL;
+static void *parametro_aviso = NULL;
+
+/**
+ * @brief Executa os handlers de uma linha de interrupção habilitada
+ */
+static void chamar_handlers(uint num)
+{
+    if (!irq_habilitada[num])
+        return;
+    for (int i = 0; i < MAX_HANDLERS_IRQ && handlers[num][i] != NULL; i++)
+        handlers[num][i]();
+}
+
+/**
+ * @brief Ticks de espera até um instante (pelo menos um, no máximo o teto)
+ */
+static TickType_t ticks_ate(uint64_t agora_us, uint64_t instante_us)
+{
+    uint64_t ms = (instante_us > agora_us) ? (instante_us - agora_us + 999u) / 1000u : 1;
+    if (ms > ESPERA_MAX_INTERRUPCOES_MS)
+        ms = ESPERA_MAX_INTERRUPCOES_MS;
+    TickType_t ticks = pdMS_TO_TICKS((uint32_t)ms);
+    return ticks ? ticks : 1;
+}
+
+static uint64_t minimo(uint64_t a, uint64_t b)
+{
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Encerra a simulação com o resumo do tempo simulado
+ */
+static void encerrar(uint64_t agora_us)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    double reais = (double)(ts.tv_sec - inicio_real.tv_sec) + (double)(ts.tv_nsec - inicio_real.tv_nsec) / 1e9;
+    uint64_t simulado = agora_us - sim_relogio_inicio_us();
+
+    // O resumo vai para stderr: o tempo real não entra no registro, que deve
+    // ser igual entre execuções no relógio virtual
+    sim_registrar("sim", "fim");
+    fprintf(stderr, "sim: fim da simulacao em %llu us (%s, %.2f s reais, %llu saltos)\n",
+            (unsigned long long)simulado, sim_relogio_virtual() ? "relogio virtual" : "relogio real", reais,
+            (unsigned long long)sim_relogio_saltos());
+    sim_encerrar_registro();
+    exit(0);
+}
+
+/**
+ * @brief Task que faz o papel do controlador de interrupções
+ *
+ * Roda na maior prioridade e dorme até o próximo evento: estímulo, alarme,
+ * fim de DMA ou fim da simulação. Com o escalonador suspenso, nenhuma task
+ * do firmware roda no meio de um "handler".
+ */
+static void tarefa_interrupcoes(void *parametro)
+{
+    (void)parametro;
+    sim_relogio_desligar_tick_real();
+
+    while (true)
+    {
+        uint64_t agora = time_us_64();
+
+        vTaskSuspendAll();
+        sim_estimulos_atender(agora);
+        if (irq_habilitada[IO_IRQ_BANK0])
+            sim_gpio_atender();
+        sim_tempo_atender(agora);
+        sim_adc_atender(agora);
+        sim_pwm_dma_atender(agora);
+        sim_i2c_dma_atender(agora);
+        if (sim_dma_irq0_pendente())
+            chamar_handlers(DMA_IRQ_0);
+        if (sim_dma_irq1_pendente())
+            chamar_handlers(DMA_IRQ_1);
+
+        uint64_t proximo = minimo(sim_estimulos_proximo_us(), sim_tempo_proximo_us());
+        proximo = minimo(proximo, sim_adc_proximo_us(agora));
+        proximo = minimo(proximo, sim_pwm_dma_proximo_us());
+        proximo = minimo(proximo, sim_i2c_dma_proximo_us());
+        xTaskResumeAll();
+
+        if (fim_us)
+        {
+            if (agora >= fim_us)
+                encerrar(agora);
+            proximo = minimo(proximo, fim_us);
+        }
+
+        ulTaskNotifyTake(pdTRUE, ticks_ate(agora, proximo));
+    }
+}
+
+void sim_acordar_interrupcoes(void)
+{
+    if (tarefa_irq == NULL || xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED ||
+        xTaskGetCurrentTaskHandle() == tarefa_irq)
+        return;
+    xTaskNotifyGive(tarefa_irq);
+}
+
+void sim_iniciar(void)
+{
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    clock_gettime(CLOCK_MONOTONIC, &inicio_real);
+
+    // O relógio vem antes de tudo: estímulos e duração contam a partir do início dele
+    const char *relogio = getenv("SEMAFORO_SIM_RELOGIO");
+    const char *inicio = getenv("SEMAFORO_SIM_INICIO_MS");
+    sim_relogio_configurar(relogio != NULL && strcmp(relogio, "virtual") == 0,
+                           inicio ? strtoull(inicio, NULL, 10) * 1000u : 0);
+
+    const char *estimulos = getenv("SEMAFORO_SIM_ESTIMULOS");
+    if (estimulos != NULL)
+        sim_estimulos_carregar(estimulos);
+
+    const char *duracao = getenv("SEMAFORO_SIM_DURACAO_MS");
+    if (duracao != NULL)
+        fim_us = sim_relogio_inicio_us() + strtoull(duracao, NULL, 10) * 1000u;
+
+    sim_registrar("sim", "inicio relogio=%s", sim_relogio_virtual() ? "virtual" : "real");
+    xTaskCreate(tarefa_interrupcoes, "sim: interrupcoes", configMINIMAL_STACK_SIZE, NULL,
+                configMAX_PRIORITIES - 1, &tarefa_irq);
+}
+
+bool stdio_init_all(void)
+{
+    sim_iniciar();
+    return true;
+}
+
+void stdio_set_chars_available_callback(void (*fn)(void *), void *param)
+{
+    aviso_caracteres = fn;
+    parametro_aviso = param;
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    (void)timeout_us; // Sem espera: a entrada só muda pelos estímulos
+    uint32_t estado = save_and_disable_interrupts();
+    int c = PICO_ERROR_TIMEOUT;
+    if (entrada_lida != entrada_escrita)
+        c = (unsigned char)entrada_console[entrada_lida++ % TAMANHO_ENTRADA_CONSOLE];
+    restore_interrupts(estado);
+    return c;
+}
+
+void sim_console_entrada(const char *texto)
+{
+    sim_registrar("stdin", "%s", texto);
+
+    uint32_t estado = save_and_disable_interrupts();
+    for (const char *p = texto;; p++)
+    {
+        if (entrada_escrita - entrada_lida >= TAMANHO_ENTRADA_CONSOLE)
+            break; // Buffer cheio: o resto se perde, como na UART
+        entrada_console[entrada_escrita++ % TAMANHO_ENTRADA_CONSOLE] = *p ? *p : '\n';
+        if (*p == '\0')
+            break;
+    }
+    restore_interrupts(estado);
+
+    if (aviso_caracteres != NULL)
+        aviso_caracteres(parametro_aviso);
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority)
+{
+    (void)order_priority;
+    for (int i = 0; i < MAX_HANDLERS_IRQ; i++)
+    {
+        if (handlers[num][i] == NULL)
+        {
+            handlers[num][i] = handler;
+            return;
+        }
+    }
+    panic("irq: handlers demais na linha %u", num);
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+    handlers[num][0] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+    irq_habilitada[num] = enabled;
+}
+
+void irq_set_priority(uint num, uint8_t hardware_priority)
+{
+    (void)num;
+    (void)hardware_priority;
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)
+        return 0;
+    vTaskSuspendAll();
+    return 1;
+}
+
+void restore_interrupts(uint32_t status)
+{
+    if (status)
+        xTaskResumeAll();
+}
+
+void panic(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "panic: ");
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+    sim_encerrar_registro();
+    exit(1);
+}
+
+void panic_unsupported(void)
+{
+    panic("nao suportado");
+}
+
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask)
+{
+    (void)usb_activity_gpio_pin_mask;
+    (void)disable_interface_mask;
+    sim_registrar("sistema", "reset_usb_boot");
+    sim_encerrar_registro();
+    exit(0);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file sim.h
+ * @brief Núcleo da simulação do firmware em Linux
+ *
+ * A simulação compila o firmware contra os cabeçalhos de sim/include e o
+ * port POSIX do FreeRTOS. Interrupções (bordas de GPIO, alarmes, timers
+ * repetitivos) são atendidas por uma task de maior prioridade que dorme até
+ * o próximo evento (estímulo, alarme, DMA); desabilitar interrupções
+ * suspende o escalonador.
+ *
+ * Toda escrita em periférico, e cada linha impressa pelo firmware
+ * ("console"), gera uma linha no registro:
+ *
+ *     <tempo_us> <periférico> <detalhes>
+ *
+ * Variáveis de ambiente:
+ * - SEMAFORO_SIM_REGISTRO: arquivo do registro (padrão: perifericos.log)
+ * - SEMAFORO_SIM_ESTIMULOS: roteiro de estímulos (ver estimulos.c)
+ * - SEMAFORO_SIM_DURACAO_MS: encerra a simulação após este tempo
+ * - SEMAFORO_SIM_RELOGIO: "virtual" para o relógio virtual (ver tempo.c)
+ * - SEMAFORO_SIM_INICIO_MS: tempo inicial do relógio (ex.: 4294900000 para
+ *   passar pela volta de to_ms_since_boot() logo no início)
+ * - SEMAFORO_SIM_FILTRO: prefixos de periféricos registrados, separados
+ *   por vírgula (ex.: "pwm,console"); padrão: todos
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Prepara registro, estímulos e a task de interrupções
+ *
+ * Chamada por stdio_init_all(), a primeira chamada do main() do firmware.
+ */
+void sim_iniciar(void);
+
+/**
+ * @brief Acrescenta uma linha ao registro de periféricos
+ *
+ * @param periferico Nome curto (gpio, pwm, i2c1, pio0, dma, adc...)
+ * @param formato Detalhes no formato de printf
+ */
+void sim_registrar(const char *periferico, const char *formato, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Fecha o registro (fim da simulação)
+ */
+void sim_encerrar_registro(void);
+
+/**
+ * @brief Hash FNV-1a de 32 bits, usado para resumir blocos grandes no registro
+ */
+uint32_t sim_hash(const void *dados, size_t tamanho);
+uint32_t sim_hash_continuar(uint32_t hash, const void *dados, size_t tamanho);
+
+/**
+ * @brief Nome estável de um endereço de periférico (ou "ram")
+ *
+ * Evita imprimir ponteiros do processo, que mudam a cada execução.
+ */
+const char *sim_nome_endereco(const volatile void *endereco);
+
+/* Relógio (ver tempo.c) */
+void sim_relogio_configurar(bool virtual, uint64_t deslocamento_us);
+bool sim_relogio_virtual(void);
+uint64_t sim_relogio_inicio_us(void);
+uint64_t sim_relogio_saltos(void);
+void sim_relogio_desligar_tick_real(void);
+
+/**
+ * @brief Acorda a task de interrupções para recalcular o próximo evento
+ *
+ * Usada quando uma task agenda um alarme que pode vencer antes do prazo em
+ * que a task de interrupções ia acordar.
+ */
+void sim_acordar_interrupcoes(void);
+
+/* Atendimento das "interrupções" (chamados pela task de interrupções) */
+void sim_tempo_atender(uint64_t agora_us);
+void sim_gpio_atender(void);
+void sim_adc_atender(uint64_t agora_us);
+void sim_pwm_dma_atender(uint64_t agora_us);
+void sim_i2c_dma_atender(uint64_t agora_us);
+void sim_estimulos_atender(uint64_t agora_us);
+bool sim_dma_irq0_pendente(void);
+bool sim_dma_irq1_pendente(void);
+
+/* Próximo instante com algo a atender (UINT64_MAX = nenhum) */
+uint64_t sim_tempo_proximo_us(void);
+uint64_t sim_adc_proximo_us(uint64_t agora_us);
+uint64_t sim_pwm_dma_proximo_us(void);
+uint64_t sim_i2c_dma_proximo_us(void);
+uint64_t sim_estimulos_proximo_us(void);
+
+/* Entradas do mundo externo (usadas pelos estímulos) */
+void sim_gpio_nivel_externo(unsigned pino, int nivel); // -1 = desconectado
+void sim_adc_definir(unsigned canal, uint16_t valor);
+
+/* Falhas de um dispositivo I2C (usadas pelos estímulos) */
+typedef enum
+{
+    SIM_I2C_OK = 0, /**< Responde a tudo */
+    SIM_I2C_NACK,   /**< Ausente: não dá ACK ao endereço */
+    SIM_I2C_PRESO,  /**< Na próxima transferência trava segurando o SDA, até pulsos no SCL */
+} SimFalhaI2C;
+void sim_i2c_definir_falha(unsigned endereco, SimFalhaI2C falha);
+
+/* Ligação entre GPIO e I2C para o escravo preso */
+int sim_gpio_pino_i2c(unsigned indice, bool scl); // Pino na função I2C, ou -1
+void sim_i2c_borda_descida(unsigned pino);
+
+/**
+ * @brief Texto digitado no console (uma linha, sem o '\n')
+ *
+ * Fica disponível para getchar_timeout_us() e dispara o aviso de
+ * caracteres registrado com stdio_set_chars_available_callback().
+ */
+void sim_console_entrada(const char *texto);
+
+/* Estímulos */
+void sim_estimulos_carregar(const char *caminho);
+
+#endif /* SIM_H_ */
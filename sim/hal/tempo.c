@@ -0,0 +1,340 @@
+/**
+ * @file tempo.c
+ * @brief Tempo, alarmes e timers repetitivos da simulação
+ *
+ * Dois relógios:
+ * - real: o relógio monotônico do Linux desde o início do processo;
+ * - virtual: o contador de ticks do FreeRTOS (1 ms). O tempo só anda quando
+ *   todas as tasks estão bloqueadas: o idle salta o tick direto para o
+ *   próximo prazo (portSUPPRESS_TICKS_AND_SLEEP) e o processamento não
+ *   consome tempo simulado. Dias de operação rodam em segundos e duas
+ *   execuções com os mesmos estímulos geram o mesmo registro.
+ *
+ * Os dois aceitam um deslocamento inicial, para testar a volta dos
+ * contadores de 32 bits. Os alarmes vencem na task de interrupções, com a
+ * resolução de um tick.
+ */
+
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <sys/time.h>
+#include <time.h>
+
+#define MAX_ALARMES 16
+
+typedef struct
+{
+    bool ativo;
+    alarm_id_t id;
+    uint64_t vencimento_us;
+    alarm_callback_t callback;
+    void *dados;
+    repeating_timer_t *repetitivo; // Não nulo para timers repetitivos
+} Alarme;
+
+static Alarme alarmes[MAX_ALARMES];
+static alarm_id_t proximo_id = 1;
+
+static bool relogio_virtual = false;
+static uint64_t inicio_us = 0;            // Deslocamento inicial do relógio
+static uint64_t antes_escalonador_us = 0; // Virtual: esperas antes do escalonador
+static uint64_t ticks_totais = 0;         // Virtual: ticks desde o início, sem volta
+static TickType_t ultimo_tick = 0;
+static bool outra_tarefa_rodou = false;
+static uint64_t saltos = 0;
+
+void sim_relogio_configurar(bool virtual, uint64_t deslocamento_us)
+{
+    relogio_virtual = virtual;
+    inicio_us = deslocamento_us;
+}
+
+bool sim_relogio_virtual(void)
+{
+    return relogio_virtual;
+}
+
+uint64_t sim_relogio_inicio_us(void)
+{
+    return inicio_us;
+}
+
+uint64_t sim_relogio_saltos(void)
+{
+    return saltos;
+}
+
+void sim_relogio_desligar_tick_real(void)
+{
+    // O port POSIX gera o tick com setitimer(ITIMER_REAL); no relógio
+    // virtual o tick só anda pelos saltos do idle
+    if (!relogio_virtual)
+        return;
+    struct itimerval parado = {0};
+    setitimer(ITIMER_REAL, &parado, NULL);
+}
+
+void sim_relogio_saltar(uint32_t ticks)
+{
+    // Chamada pelo idle com o escalonador suspenso; o último tick do salto
+    // fica pendente e desbloqueia as tasks em xTaskResumeAll()
+    if (!relogio_virtual)
+        return;
+    vTaskStepTick(ticks);
+    saltos++;
+}
+
+void sim_relogio_tarefa_entrou(void)
+{
+    if (xTaskGetCurrentTaskHandle() != xTaskGetIdleTaskHandle())
+        outra_tarefa_rodou = true;
+}
+
+/*
+ * Prazo a um tick: o kernel só chama portSUPPRESS_TICKS_AND_SLEEP para
+ * esperas de pelo menos configEXPECTED_IDLE_TIME_BEFORE_SLEEP (2) ticks.
+ * Se nenhuma outra task rodou desde a passagem anterior do idle, todas
+ * estão bloqueadas e o tick pode avançar.
+ */
+void vApplicationIdleHook(void)
+{
+    if (!relogio_virtual)
+        return;
+    if (outra_tarefa_rodou)
+    {
+        outra_tarefa_rodou = false;
+        return;
+    }
+    xTaskCatchUpTicks(1);
+}
+
+/*
+ * O port do RP2040 reprograma o SysTick com o clk_sys atual quando ele muda
+ * (lib/energia.c); o tick da simulação não depende do clock.
+ */
+void vPortSetupTimerInterrupt(void)
+{
+}
+
+uint64_t time_us_64(void)
+{
+    if (relogio_virtual)
+    {
+        // Só uma task roda por vez no port POSIX e o tick real está desligado
+        if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+        {
+            TickType_t agora = xTaskGetTickCount();
+            ticks_totais += (TickType_t)(agora - ultimo_tick);
+            ultimo_tick = agora;
+        }
+        return inicio_us + antes_escalonador_us + ticks_totais * (1000000u / configTICK_RATE_HZ);
+    }
+
+    static uint64_t inicio_ns = 0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t agora_ns = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+    if (inicio_ns == 0)
+        inicio_ns = agora_ns;
+    return inicio_us + (agora_ns - inicio_ns) / 1000u;
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+absolute_time_t get_absolute_time(void)
+{
+    return time_us_64();
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t)
+{
+    return (uint32_t)(t / 1000u);
+}
+
+uint64_t to_us_since_boot(absolute_time_t t)
+{
+    return t;
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us)
+{
+    return time_us_64() + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms)
+{
+    return time_us_64() + (uint64_t)ms * 1000u;
+}
+
+void busy_wait_us(uint64_t us)
+{
+    // No relógio virtual o tempo não anda enquanto a task gira
+    if (relogio_virtual)
+    {
+        sleep_us(us);
+        return;
+    }
+
+    uint64_t fim = time_us_64() + us;
+    while (time_us_64() < fim)
+        ;
+}
+
+void busy_wait_us_32(uint32_t us)
+{
+    busy_wait_us(us);
+}
+
+void busy_wait_ms(uint32_t ms)
+{
+    busy_wait_us((uint64_t)ms * 1000u);
+}
+
+void sleep_us(uint64_t us)
+{
+    // Com o escalonador rodando, dormir é bloquear a task
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+        TickType_t ticks = pdMS_TO_TICKS((us + 999u) / 1000u);
+        vTaskDelay(ticks ? ticks : 1);
+        return;
+    }
+
+    // Virtual: antes do escalonador a espera só avança o relógio; com o
+    // escalonador suspenso (interrupção simulada) ela não tem duração
+    if (relogio_virtual)
+    {
+        if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+            antes_escalonador_us += us;
+        return;
+    }
+
+    struct timespec ts = {.tv_sec = (time_t)(us / 1000000u), .tv_nsec = (long)(us % 1000000u) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+/**
+ * @brief Ocupa uma posição livre da tabela de alarmes
+ */
+static alarm_id_t agendar(uint64_t vencimento_us, alarm_callback_t callback, void *dados, repeating_timer_t *rt)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    alarm_id_t id = -1;
+    for (int i = 0; i < MAX_ALARMES; i++)
+    {
+        if (!alarmes[i].ativo)
+        {
+            id = proximo_id++;
+            alarmes[i] = (Alarme){true, id, vencimento_us, callback, dados, rt};
+            break;
+        }
+    }
+    restore_interrupts(estado);
+    sim_acordar_interrupcoes();
+    return id;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    (void)fire_if_past;
+    return agendar(time_us_64() + us, callback, user_data, NULL);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us((uint64_t)ms * 1000u, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t id)
+{
+    uint32_t estado = save_and_disable_interrupts();
+    bool cancelado = false;
+    for (int i = 0; i < MAX_ALARMES; i++)
+    {
+        if (alarmes[i].ativo && alarmes[i].id == id)
+        {
+            alarmes[i].ativo = false;
+            cancelado = true;
+        }
+    }
+    restore_interrupts(estado);
+    return cancelado;
+}
+
+bool add_repeating_timer_us(int64_t delay_us, repeating_timer_callback_t callback, void *user_data,
+                            repeating_timer_t *out)
+{
+    // Como no SDK: atraso negativo conta do início da chamada anterior
+    out->delay_us = delay_us;
+    out->user_data = user_data;
+    out->callback = callback;
+    uint64_t periodo = (uint64_t)(delay_us < 0 ? -delay_us : delay_us);
+    out->alarm_id = agendar(time_us_64() + periodo, NULL, NULL, out);
+    return out->alarm_id > 0;
+}
+
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback, void *user_data,
+                            repeating_timer_t *out)
+{
+    return add_repeating_timer_us((int64_t)delay_ms * 1000, callback, user_data, out);
+}
+
+bool cancel_repeating_timer(repeating_timer_t *timer)
+{
+    return cancel_alarm(timer->alarm_id);
+}
+
+void sim_tempo_atender(uint64_t agora_us)
+{
+    for (int i = 0; i < MAX_ALARMES; i++)
+    {
+        Alarme *a = &alarmes[i];
+        if (!a->ativo || a->vencimento_us > agora_us)
+            continue;
+
+        if (a->repetitivo != NULL)
+        {
+            repeating_timer_t *rt = a->repetitivo;
+            uint64_t periodo = (uint64_t)(rt->delay_us < 0 ? -rt->delay_us : rt->delay_us);
+            uint64_t base = a->vencimento_us;
+            if (!rt->callback(rt))
+                a->ativo = false;
+            else
+                a->vencimento_us = (rt->delay_us < 0 ? base : agora_us) + periodo;
+            continue;
+        }
+
+        // Retorno > 0 reagenda relativo ao vencimento anterior, < 0 relativo ao agora.
+        // A posição continua ocupada durante o callback para não ser reutilizada.
+        uint64_t vencimento = a->vencimento_us;
+        int64_t r = a->callback(a->id, a->dados);
+        if (r == 0 || !a->ativo)
+            a->ativo = false;
+        else if (r > 0)
+            a->vencimento_us = vencimento + (uint64_t)r;
+        else
+            a->vencimento_us = agora_us + (uint64_t)(-r);
+    }
+}
+
+uint64_t sim_tempo_proximo_us(void)
+{
+    uint64_t proximo = UINT64_MAX;
+    for (int i = 0; i < MAX_ALARMES; i++)
+    {
+        if (alarmes[i].ativo && alarmes[i].vencimento_us < proximo)
+            proximo = alarmes[i].vencimento_us;
+    }
+    return proximo;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file adc.h
+ * @brief Simulação: ADC em round-robin com FIFO e DREQ
+ *
+ * O valor de cada canal vem dos estímulos da simulação (sim/hal/sim.h).
+ */
+
+#ifndef SIM_HARDWARE_ADC_H_
+#define SIM_HARDWARE_ADC_H_
+
+#include "pico/stdlib.h"
+
+#define DREQ_ADC 36
+
+typedef struct
+{
+    volatile uint32_t cs, result, fcs, fifo, div;
+} adc_hw_t;
+
+extern adc_hw_t *adc_hw;
+
+void adc_init(void);
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+void adc_set_round_robin(uint input_mask);
+void adc_fifo_setup(bool en, bool dreq_en, uint16_t dreq_thresh, bool err_in_fifo, bool byte_shift);
+void adc_set_clkdiv(float clkdiv);
+void adc_run(bool run);
+void adc_fifo_drain(void);
+uint16_t adc_read(void);
+
+#endif /* SIM_HARDWARE_ADC_H_ */
@@ -0,0 +1,62 @@
+/**
+ * @file i2c.h
+ * @brief Simulação: I2C mestre (escritas registradas, falhas por estímulo)
+ *
+ * Os registradores usados por quem alimenta o FIFO por DMA existem; o
+ * tempo de fio dessas transferências é modelado em sim/hal/perifericos.c.
+ * Os dispositivos respondem a tudo, a menos que um estímulo os faça dar
+ * NACK ou travar o barramento (sim/hal/sim.h). Como ler um registro não
+ * tem efeito aqui, o aborto (TX_ABRT) é limpo no início da transferência
+ * seguinte e no i2c_init().
+ */
+
+#ifndef SIM_HARDWARE_I2C_H_
+#define SIM_HARDWARE_I2C_H_
+
+#include "pico/stdlib.h"
+
+#define DREQ_I2C0_TX 32
+#define I2C_IC_DATA_CMD_STOP_BITS 0x200u
+#define I2C_IC_STATUS_TFE_BITS 0x4u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS 0x20u
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS 0x40u
+#define I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS 0x1u
+#define I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS 0x8u
+
+typedef struct
+{
+    volatile uint32_t tar;
+    volatile uint32_t data_cmd;
+    volatile uint32_t enable;
+    volatile uint32_t status;
+    volatile uint32_t raw_intr_stat;
+    volatile uint32_t tx_abrt_source;
+    volatile uint32_t clr_tx_abrt;
+} i2c_hw_t;
+
+typedef struct i2c_inst
+{
+    uint8_t indice;
+    uint baudrate;
+    i2c_hw_t regs;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+void i2c_deinit(i2c_inst_t *i2c);
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop,
+                         uint timeout_us);
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us);
+static inline uint i2c_hw_index(i2c_inst_t *i2c) { return i2c->indice; }
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return &i2c->regs; }
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) { return DREQ_I2C0_TX + 2u * i2c->indice + !is_tx; }
+
+#endif /* SIM_HARDWARE_I2C_H_ */
@@ -0,0 +1,66 @@
+/**
+ * @file pio.h
+ * @brief Simulação: PIO (programas aceitos, palavras do FIFO TX registradas)
+ */
+
+#ifndef SIM_HARDWARE_PIO_H_
+#define SIM_HARDWARE_PIO_H_
+
+#include "pico/stdlib.h"
+
+#define NUM_PIO_STATE_MACHINES 4
+#define PIO_FIFO_JOIN_TX 1
+#define DREQ_PIO0_TX0 0
+#define DREQ_PIO0_RX0 4
+#define DREQ_PIO1_TX0 8
+#define DREQ_PIO1_RX0 12
+
+typedef struct
+{
+    uint8_t indice;
+    uint8_t sm_usadas;
+    uint8_t memoria_usada;
+    volatile uint32_t txf[NUM_PIO_STATE_MACHINES];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t pio0_hw_sim;
+extern pio_hw_t pio1_hw_sim;
+
+#define pio0 (&pio0_hw_sim)
+#define pio1 (&pio1_hw_sim)
+
+typedef struct
+{
+    uint32_t clkdiv, execctrl, shiftctrl, pinctrl;
+} pio_sm_config;
+
+typedef struct
+{
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+uint pio_add_program(PIO pio, const pio_program_t *program);
+int pio_claim_unused_sm(PIO pio, bool required);
+void pio_gpio_init(PIO pio, uint pin);
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out);
+pio_sm_config pio_get_default_sm_config(void);
+void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base);
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold);
+void sm_config_set_fifo_join(pio_sm_config *c, int join);
+void sm_config_set_clkdiv(pio_sm_config *c, float div);
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+void pio_sm_put(PIO pio, uint sm, uint32_t data);
+
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    return (pio->indice ? (is_tx ? DREQ_PIO1_TX0 : DREQ_PIO1_RX0) : (is_tx ? DREQ_PIO0_TX0 : DREQ_PIO0_RX0)) + sm;
+}
+
+#endif /* SIM_HARDWARE_PIO_H_ */
@@ -0,0 +1,50 @@
+/**
+ * @file pwm.h
+ * @brief Simulação: PWM com registradores em memória
+ */
+
+#ifndef SIM_HARDWARE_PWM_H_
+#define SIM_HARDWARE_PWM_H_
+
+#include "pico/stdlib.h"
+
+#define NUM_PWM_SLICES 8
+#define PWM_CHAN_A 0
+#define PWM_CHAN_B 1
+#define DREQ_PWM_WRAP0 24
+#define PWM_DREQ_NUM(slice) (DREQ_PWM_WRAP0 + (slice))
+
+typedef struct
+{
+    uint32_t csr;
+    uint32_t div;
+    uint32_t top;
+} pwm_config;
+
+typedef struct
+{
+    volatile uint32_t csr, div, ctr, cc, top;
+} pwm_slice_hw_t;
+
+typedef struct
+{
+    pwm_slice_hw_t slice[NUM_PWM_SLICES];
+    volatile uint32_t en, intr, inte, intf, ints;
+} pwm_hw_t;
+
+extern pwm_hw_t *pwm_hw;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio) { return (gpio >> 1u) & 7u; }
+static inline uint pwm_gpio_to_channel(uint gpio) { return gpio & 1u; }
+
+pwm_config pwm_get_default_config(void);
+void pwm_config_set_clkdiv(pwm_config *c, float div);
+void pwm_config_set_wrap(pwm_config *c, uint16_t wrap);
+void pwm_init(uint slice_num, pwm_config *c, bool start);
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+void pwm_set_clkdiv(uint slice_num, float divider);
+void pwm_set_enabled(uint slice_num, bool enabled);
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level);
+void pwm_set_gpio_level(uint gpio, uint16_t level);
+
+#endif /* SIM_HARDWARE_PWM_H_ */
@@ -0,0 +1,2 @@
+/** @file sync.h @brief Simulação: hardware/sync.h (declarado em pico/sync.h) */
+#include "pico/sync.h"
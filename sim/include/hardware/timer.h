@@ -0,0 +1,2 @@
+/** @file timer.h @brief Simulação: hardware/timer.h (declarado em pico/stdlib.h) */
+#include "pico/stdlib.h"
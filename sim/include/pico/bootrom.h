@@ -0,0 +1,9 @@
+/** @file bootrom.h @brief Simulação: reset para o bootloader encerra a simulação */
+#ifndef SIM_PICO_BOOTROM_H_
+#define SIM_PICO_BOOTROM_H_
+
+#include "pico/stdlib.h"
+
+void reset_usb_boot(uint32_t usb_activity_gpio_pin_mask, uint32_t disable_interface_mask);
+
+#endif /* SIM_PICO_BOOTROM_H_ */
@@ -0,0 +1,17 @@
+/**
+ * @file sync.h
+ * @brief Simulação: seções com "interrupções" desabilitadas
+ *
+ * As interrupções simuladas rodam numa task do FreeRTOS (sim/hal/irq.c);
+ * desabilitá-las equivale a suspender o escalonador.
+ */
+
+#ifndef SIM_PICO_SYNC_H_
+#define SIM_PICO_SYNC_H_
+
+#include "pico/stdlib.h"
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+#endif /* SIM_PICO_SYNC_H_ */
@@ -0,0 +1,2 @@
+/** @file time.h @brief Simulação: pico/time.h (declarado em pico/stdlib.h) */
+#include "pico/stdlib.h"
@@ -0,0 +1,46 @@
+/**
+ * @file ws2818b.pio.h
+ * @brief Simulação: equivalente ao cabeçalho gerado por pioasm para ws2818b.pio
+ */
+
+#ifndef SIM_WS2818B_PIO_H_
+#define SIM_WS2818B_PIO_H_
+
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+
+static const uint16_t ws2818b_program_instructions[] = {
+    0x6221, // out x, 1        side 0 [2]
+    0x1123, // jmp !x, 3       side 1 [1]
+    0x1400, // jmp 0           side 1 [4]
+    0xa442, // nop             side 0 [4]
+};
+
+static const pio_program_t ws2818b_program = {
+    .instructions = ws2818b_program_instructions,
+    .length = 4,
+    .origin = -1,
+};
+
+static inline pio_sm_config ws2818b_program_get_default_config(uint offset)
+{
+    (void)offset;
+    return pio_get_default_sm_config();
+}
+
+static inline void ws2818b_program_init(PIO pio, uint sm, uint offset, uint pin, float freq)
+{
+    pio_gpio_init(pio, pin);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+
+    pio_sm_config c = ws2818b_program_get_default_config(offset);
+    sm_config_set_sideset_pins(&c, pin);
+    sm_config_set_out_shift(&c, true, true, 8);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv(&c, clock_get_hz(clk_sys) / (10.f * freq));
+
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif /* SIM_WS2818B_PIO_H_ */